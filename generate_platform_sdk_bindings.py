@@ -11,6 +11,27 @@ EXCLUDE_OVR_HEADERS = [
     'OVR_Requests_ApplicationLifecycle.h',
 ]
 
+# Hand-written classes that call into API families (from 'OVR_Requests_*.h' and 'OVR_Functions_*.h'), so
+# they're only built when all of those are selected with 'platform_sdk_modules'. Keyed by source file.
+PLATFORM_SDK_MODULE_HELPERS = {
+    'meta_platform_sdk_download_manager': ['AssetFile'],
+    'meta_platform_sdk_leaderboard_cache': ['Leaderboard'],
+    'meta_platform_sdk_leaderboard_window': ['Leaderboard'],
+    'meta_platform_sdk_warm_start_cache': ['Achievements', 'Entitlement', 'IAP', 'User'],
+    'meta_platform_sdk_write_queue': ['Leaderboard'],
+}
+
+# OVR headers for classes that are always bound, because they have hand-written functions, or are used
+# by the message pump.
+REQUIRED_OVR_HEADERS = [
+    'OVR_ChallengeEntry.h',
+    'OVR_Error.h',
+    'OVR_HttpTransferUpdate.h',
+    'OVR_Message.h',
+    'OVR_Packet.h',
+    'OVR_PlatformInitialize.h',
+]
+
 # Exclude these OVR functions from both source and header generation.
 EXCLUDE_OVR_FUNCTIONS = [
     # All of the initialization functions are handled specially.
@@ -418,6 +439,83 @@ FUNCTION_RENAMES = {
     },
 }
 
+# Classes with hand-written functions that copy binary data into a MetaPlatformSDK_ByteBuffer, mapped to
+# the name of the function that returns the same data as a PackedByteArray. MetaPlatformSDK_LeaderboardEntry
+# is only generated when the Leaderboard module is selected, so its hand-written functions are wrapped in
+# 'META_PLATFORM_SDK_MODULE_LEADERBOARD'.
+BYTE_BUFFER_CLASSES = {
+    'MetaPlatformSDK_ChallengeEntry': 'get_extra_data',
+    'MetaPlatformSDK_HttpTransferUpdate': 'get_bytes',
+    'MetaPlatformSDK_LeaderboardEntry': 'get_extra_data',
+    'MetaPlatformSDK_Packet': 'get_bytes',
+}
+
+# Hand-written getters whose values are also copied when a result is detached from its message, as
+# (type, member name, getter name).
+SNAPSHOT_EXTRA_FIELDS = {
+    'MetaPlatformSDK_ChallengeEntry': [('PackedByteArray', 'extra_data', 'get_extra_data')],
+    'MetaPlatformSDK_HttpTransferUpdate': [('uint64_t', 'id', 'get_id'), ('PackedByteArray', 'bytes', 'get_bytes')],
+    'MetaPlatformSDK_LeaderboardEntry': [('PackedByteArray', 'extra_data', 'get_extra_data')],
+    'MetaPlatformSDK_Message': [('uint64_t', 'request_id', 'get_request_id')],
+    'MetaPlatformSDK_Packet': [('PackedByteArray', 'bytes', 'get_bytes')],
+}
+
+# Field names that can't be used as C++ identifiers.
+CPP_KEYWORDS = ['class', 'default', 'delete', 'new', 'operator', 'private', 'protected', 'public', 'template', 'this']
+
+# Notifications that handlers can filter by an id, mapped to the OVR functions that get the payload from
+# the message, and the id from the payload. Only used when both functions are in the headers.
+NOTIFICATION_FILTER_IDS = {
+    'ovrMessage_Notification_AssetFile_DownloadUpdate': ('ovr_Message_GetAssetFileDownloadUpdate', 'ovr_AssetFileDownloadUpdate_GetAssetId'),
+    'ovrMessage_Notification_HTTP_Transfer': ('ovr_Message_GetHttpTransferUpdate', 'ovr_HttpTransferUpdate_GetID'),
+    'ovrMessage_Notification_NetSync_ConnectionStatusChanged': ('ovr_Message_GetNetSyncConnection', 'ovr_NetSyncConnection_GetConnectionId'),
+    'ovrMessage_Notification_NetSync_SessionsChanged': ('ovr_Message_GetNetSyncSessionsChangedNotification', 'ovr_NetSyncSessionsChangedNotification_GetConnectionId'),
+}
+
+# Notifications that only report the latest state of something, so all but the newest one for each key
+# can be dropped when several arrive in the same frame. Each entry gives the payload getter, the key
+# getter (or None if there's only one key), and a getter for whether the update is the last one for
+# its key (or None), since those must always be delivered. HTTP transfer updates aren't here, because
+# each one carries its own chunk of the response.
+NOTIFICATION_COALESCE_KEYS = {
+    'ovrMessage_Notification_AssetFile_DownloadUpdate': ('ovr_Message_GetAssetFileDownloadUpdate', 'ovr_AssetFileDownloadUpdate_GetAssetId', 'ovr_AssetFileDownloadUpdate_GetCompleted'),
+    'ovrMessage_Notification_Cowatching_ViewersDataChanged': ('ovr_Message_GetCowatchViewerUpdate', None, None),
+}
+
+# Async functions that look like reads, but must never share a response between callers.
+COALESCE_EXCLUDE = [
+    'device_application_integrity_get_integrity_token_async',
+    'user_get_user_proof_async',
+]
+
+# String arguments that are passed the same few values over and over, whose UTF-8 encoding is cached
+# by MetaPlatformSDKStringCache.
+CACHED_STRING_ARGUMENTS = [
+    'p_asset_file_name',
+    'p_leaderboard_name',
+    'p_name',
+    'p_sku',
+]
+
+# OVR functions whose stand-ins are backed by the stub's message queue, rather than a payload field.
+# The first argument is substituted for {0}.
+STUB_FUNCTION_BODIES = {
+    'ovr_FreeMessage': 'MetaPlatformSDK_Stub::get_singleton()->_free_message({0});',
+    'ovr_IsPlatformInitialized': 'return MetaPlatformSDK_Stub::get_singleton()->_is_initialized();',
+    'ovr_Message_GetError': 'return _message({0})->is_error ? (ovrErrorHandle)&_message({0})->error : nullptr;',
+    'ovr_Message_GetRequestID': 'return _message({0})->request_id;',
+    'ovr_Message_GetString': 'return _message({0})->payload.get_string(nullptr);',
+    'ovr_Message_GetType': 'return _message({0})->type;',
+    'ovr_Message_IsError': 'return _message({0})->is_error;',
+    'ovr_PopMessage': 'return MetaPlatformSDK_Stub::get_singleton()->_pop_message();',
+}
+
+# OVR types that the stub can read from a payload field as a number.
+STUB_NUMBER_TYPES = [
+    'int', 'unsigned int', 'int32_t', 'uint32_t', 'int64_t', 'uint64_t', 'long long', 'unsigned long long',
+    'size_t', 'ovrID', 'ovrRequest',
+]
+
 # Enums using their Godot names (not the OVR ones) to keep, even though they are unused.
 KEEP_UNUSED_ENUMS = [
     'MessageType',
@@ -584,6 +682,110 @@ class HeaderParser:
         return parsed
 
 
+def get_platform_sdk_module(header_name):
+    for prefix in ['OVR_Requests_', 'OVR_Functions_']:
+        if header_name.startswith(prefix):
+            return header_name[len(prefix):-2]
+    return None
+
+
+def normalize_module_name(name):
+    name = name.strip().lower().replace('_', '')
+    return name[:-1] if name.endswith('s') else name
+
+
+def select_platform_sdk_modules(headers, modules):
+    """Removes the headers that aren't needed by the given API families, or their results."""
+    available = {}
+    for header_name in headers:
+        module = get_platform_sdk_module(header_name)
+        if module is not None:
+            available[normalize_module_name(module)] = module
+
+    selected = set()
+    for name in modules:
+        key = normalize_module_name(name)
+        if key not in available:
+            raise Exception("Unknown Platform SDK module '%s', expected one of: %s" % (name, ', '.join(sorted(available.values()))))
+        selected.add(available[key])
+
+    handle_re = re.compile(r'\bovr[A-Za-z0-9]*Handle\b')
+    handle_headers = {}
+    for header_name, header in headers.items():
+        for handle_name in header.get('handles', []):
+            handle_headers[handle_name] = header_name
+
+    def get_handles(function):
+        types = [function['return']] + [argument['type'] for argument in function['arguments']]
+        return set(handle for t in types for handle in handle_re.findall(t) if handle in handle_headers)
+
+    kept = set()
+    for header_name, header in headers.items():
+        module = get_platform_sdk_module(header_name)
+        if module is not None:
+            if module in selected:
+                kept.add(header_name)
+        elif 'handles' not in header or header_name in REQUIRED_OVR_HEADERS:
+            kept.add(header_name)
+
+    # The results of the selected APIs are only tied to them by their message types.
+    message_functions = headers['OVR_Message.h'].get('functions', {}) if 'OVR_Message.h' in headers else {}
+    for ovr_function, ovr_types in OVR_FUNCTION_TO_MESSAGE_TYPES.items():
+        if ovr_function not in message_functions:
+            continue
+        for ovr_type in ovr_types:
+            module = ovr_type[len('ovrMessage_'):]
+            if module.startswith('Notification_'):
+                module = module[len('Notification_'):]
+            if module.split('_')[0] in selected:
+                kept.update(handle_headers[x] for x in get_handles(message_functions[ovr_function]))
+
+    # Then everything those use, except for the message, which can return every kind of result.
+    pending = list(kept)
+    while len(pending) > 0:
+        header_name = pending.pop()
+        if header_name == 'OVR_Message.h':
+            continue
+        for function in headers[header_name].get('functions', {}).values():
+            for handle in get_handles(function):
+                if handle_headers[handle] not in kept:
+                    kept.add(handle_headers[handle])
+                    pending.append(handle_headers[handle])
+
+    selected_headers = {k: v for k, v in headers.items() if k in kept}
+    if 'OVR_Message.h' in selected_headers:
+        kept_handles = set(handle for handle, header_name in handle_headers.items() if header_name in kept)
+        message = dict(selected_headers['OVR_Message.h'])
+        message['functions'] = {k: v for k, v in message.get('functions', {}).items() if get_handles(v) <= kept_handles}
+        selected_headers['OVR_Message.h'] = message
+
+    return selected_headers
+
+
+def parse_platform_sdk_modules(value):
+    return [x.strip() for x in value.split(',') if x.strip() != '']
+
+
+def is_platform_sdk_module_selected(module, modules):
+    return len(modules) == 0 or normalize_module_name(module) in [normalize_module_name(x) for x in modules]
+
+
+def get_platform_sdk_module_defines(modules):
+    """Returns a 'META_PLATFORM_SDK_MODULE_*' define for each selected API family that the hand-written classes use."""
+    defines = set()
+    for helper_modules in PLATFORM_SDK_MODULE_HELPERS.values():
+        for module in helper_modules:
+            if is_platform_sdk_module_selected(module, modules):
+                defines.add('META_PLATFORM_SDK_MODULE_' + camel_to_snake_case(module).upper())
+    return sorted(defines)
+
+
+def get_excluded_platform_sdk_helpers(modules):
+    """Returns the source files of the hand-written classes whose API families weren't all selected."""
+    return [helper for helper, helper_modules in PLATFORM_SDK_MODULE_HELPERS.items()
+            if not all(is_platform_sdk_module_selected(x, modules) for x in helper_modules)]
+
+
 def camel_to_snake_case(name):
     # Fix specifically for "ID"
     name = name.replace("PID", "Pid")
@@ -861,6 +1063,23 @@ def make_codegen_plan(headers, verbose=False):
             print("Discarding unused enum:", enum_name)
         del plan['enums'][enum_name]
 
+    # Every notification gets a slot in the handler table, in the order they're declared.
+    message_types = plan['enums']['MessageType']['value_map']
+    plan['notification_types'] = [x for x in message_types if x.startswith('ovrMessage_Notification_')]
+
+    all_ovr_functions = set()
+    for header in headers.values():
+        if 'functions' in header:
+            all_ovr_functions.update(header['functions'].keys())
+    plan['notification_filters'] = {}
+    for message_type, filter_functions in NOTIFICATION_FILTER_IDS.items():
+        if message_type in message_types and all(x in all_ovr_functions for x in filter_functions):
+            plan['notification_filters'][message_type] = filter_functions
+    plan['notification_coalesce_keys'] = {}
+    for message_type, coalesce_functions in NOTIFICATION_COALESCE_KEYS.items():
+        if message_type in message_types and all(x in all_ovr_functions for x in coalesce_functions if x is not None):
+            plan['notification_coalesce_keys'][message_type] = coalesce_functions
+
     return plan
 
 
@@ -922,13 +1141,24 @@ def make_argument_name(argument):
     return 'p_' + camel_to_snake_case(argument['type'])
 
 
-def generate_code(plan, output_path):
+def generate_code(plan, headers, output_path):
     header_path = os.path.join(output_path, 'include', 'platform_sdk')
     source_path = os.path.join(output_path, 'src')
 
     os.makedirs(header_path, exist_ok=True)
     os.makedirs(source_path, exist_ok=True)
 
+    # Remove the classes left over from a previous run with different Platform SDK modules.
+    file_bases = [camel_to_snake_case(class_name) for class_name in plan['classes'].keys()]
+    for stale_path in glob.glob(os.path.join(header_path, '*.h')) + glob.glob(os.path.join(source_path, 'meta_platform_sdk*.cpp')):
+        if os.path.splitext(os.path.basename(stale_path))[0] not in file_bases:
+            os.remove(stale_path)
+
+    # Only compiled when building with platform_sdk_stub=yes.
+    with open(os.path.join(source_path, 'ovr_platform_stub.cpp'), 'wt') as fd:
+        lines = generate_stub_source(headers)
+        fd.write('\n'.join(lines))
+
     for class_name, class_def in plan['classes'].items():
         file_base = camel_to_snake_case(class_name)
         with open(os.path.join(header_path, file_base + '.h'), 'wt') as fd:
@@ -978,7 +1208,9 @@ def make_null_value(type, plan):
 
 
 def convert_argument_value_to_ovr(name, ovr_type, godot_type, plan):
-    if godot_type == 'const String &':
+    if godot_type == 'const String &' and name in CACHED_STRING_ARGUMENTS:
+        return f'MetaPlatformSDKStringCache::utf8({name}).ptr()'
+    elif godot_type == 'const String &':
         return f'{name}.utf8().ptr()'
     elif godot_type == 'const PackedStringArray &':
         return f'({ovr_type})CharStringList({name}).pointers.ptr(), {name}.size()'
@@ -995,7 +1227,7 @@ def convert_argument_value_to_ovr(name, ovr_type, godot_type, plan):
 
 def convert_return_value_from_ovr(name, ovr_type, godot_type, plan):
     if godot_type == 'String':
-        return f'String({name})'
+        return f'MetaPlatformSDKStringCache::intern({name})'
     elif godot_type == 'Ref<MetaPlatformSDK_Request>':
         return f'MetaPlatformSDK::get_singleton()->_create_request({name})'
     elif godot_type.startswith('MetaPlatformSDK::'):
@@ -1008,26 +1240,556 @@ def convert_return_value_from_ovr(name, ovr_type, godot_type, plan):
     return name
 
 
-def make_property_info_from_return_type(name, godot_type, plan):
+def get_property_type_and_hint(godot_type):
     if godot_type == 'String':
-        return f'Variant::STRING, "{name}"'
+        return ('Variant::STRING', 'PROPERTY_HINT_NONE', '')
     elif godot_type == 'bool':
-        return f'Variant::BOOL, "{name}"'
+        return ('Variant::BOOL', 'PROPERTY_HINT_NONE', '')
     elif godot_type in ['int', 'size_t', 'int64_t', 'uint64_t', 'int32_t', 'uint32_t']:
-        return f'Variant::INT, "{name}"'
+        return ('Variant::INT', 'PROPERTY_HINT_NONE', '')
     elif godot_type in ['float', 'double']:
-        return f'Variant::FLOAT, "{name}"'
+        return ('Variant::FLOAT', 'PROPERTY_HINT_NONE', '')
     elif godot_type.startswith('Packed'):
-        return f'Variant::{camel_to_snake_case(godot_type).upper()}, "{name}"'
+        return (f'Variant::{camel_to_snake_case(godot_type).upper()}', 'PROPERTY_HINT_NONE', '')
     elif godot_type.startswith('MetaPlatformSDK::'):
-        return f'Variant::INT, "{name}"'
+        return ('Variant::INT', 'PROPERTY_HINT_NONE', '')
     elif godot_type.startswith('Ref<'):
         m = re.match(r'Ref<([^>]*)>', godot_type)
-        return f'Variant::OBJECT, "{name}", PROPERTY_HINT_RESOURCE_TYPE, "{m[1]}"'
+        return ('Variant::OBJECT', 'PROPERTY_HINT_RESOURCE_TYPE', m[1])
 
     raise Exception("Cannot make property out of return value %s" % godot_type)
 
 
+def make_property_info_from_return_type(name, godot_type, plan):
+    variant_type, hint, hint_string = get_property_type_and_hint(godot_type)
+    if hint == 'PROPERTY_HINT_NONE':
+        return f'{variant_type}, "{name}"'
+    return f'{variant_type}, "{name}", {hint}, "{hint_string}"'
+
+
+def generate_bind_tables(class_name, class_def, plan):
+    """Groups the functions without arguments by signature into static tables, so each signature is only
+    bound once by the shared routines in meta_platform_sdk_binding_table.h. Returns the lines for the
+    tables, and the functions that still need to be bound one at a time."""
+    getters = {}
+    methods = {}
+    remaining = {}
+    for function_name, function in class_def['functions'].items():
+        if len(function['arguments']) > 0:
+            remaining[function_name] = function
+        elif make_function_decl(function_name, function).endswith(' const'):
+            getters.setdefault(function['return'], []).append(function_name)
+        else:
+            methods.setdefault(function['return'], []).append(function_name)
+
+    lines = []
+    for index, (return_type, function_names) in enumerate(getters.items()):
+        table_name = f'getters_{index}'
+        lines.append(f'\tstatic constexpr MetaPlatformSDKGetterBinding<{class_name}, {return_type}> {table_name}[] = {{')
+        for function_name in function_names:
+            # Add properties on most result classes.
+            if class_def['type'] == 'result' and class_name != 'MetaPlatformSDK_Message' and function_name.startswith('get_'):
+                variant_type, hint, hint_string = get_property_type_and_hint(return_type)
+                lines.append(f'\t\t{{ "{function_name}", "{function_name[4:]}", {variant_type}, {hint}, "{hint_string}", &{class_name}::{function_name} }},')
+            else:
+                lines.append(f'\t\t{{ "{function_name}", nullptr, Variant::NIL, PROPERTY_HINT_NONE, "", &{class_name}::{function_name} }},')
+        lines.append('\t};')
+        lines.append(f'\tmeta_platform_sdk_bind_getters({table_name}, std::size({table_name}));')
+    for index, (return_type, function_names) in enumerate(methods.items()):
+        table_name = f'methods_{index}'
+        lines.append(f'\tstatic constexpr MetaPlatformSDKMethodBinding<{class_name}, {return_type}> {table_name}[] = {{')
+        for function_name in function_names:
+            lines.append(f'\t\t{{ "{function_name}", &{class_name}::{function_name} }},')
+        lines.append('\t};')
+        lines.append(f'\tmeta_platform_sdk_bind_methods({table_name}, std::size({table_name}));')
+
+    return lines, remaining
+
+
+# Maps the Godot type of a field to the Packed array type and element type used to store it in a column.
+COLUMN_TYPES = {
+    'bool': ('PackedByteArray', 'uint8_t'),
+    'int32_t': ('PackedInt32Array', 'int32_t'),
+    'uint32_t': ('PackedInt64Array', 'int64_t'),
+    'int64_t': ('PackedInt64Array', 'int64_t'),
+    'uint64_t': ('PackedInt64Array', 'int64_t'),
+    'float': ('PackedFloat32Array', 'float'),
+    'double': ('PackedFloat64Array', 'double'),
+    'String': ('PackedStringArray', 'String'),
+}
+
+
+def get_column_type(godot_type):
+    if godot_type.startswith('MetaPlatformSDK::'):
+        return ('PackedInt32Array', 'int32_t')
+    return COLUMN_TYPES.get(godot_type)
+
+
+def get_column_fields(class_def, plan, nested=True):
+    """Gets the fields of a result class that can be exported in bulk, including one level of nested objects."""
+    fields = []
+    for function_name, function in class_def['functions'].items():
+        if not function_name.startswith('get_') or len(function['arguments']) > 0:
+            continue
+        if 'exclude_source' in function and function['exclude_source']:
+            continue
+
+        field = {
+            'name': function_name[4:],
+            'ovr_function': function['ovr_function'],
+            'type': function['return'],
+        }
+
+        column_type = get_column_type(function['return'])
+        if column_type:
+            field['column_type'] = column_type
+            fields.append(field)
+        elif nested and function['return'].startswith('Ref<') and function['return'] != 'Ref<MetaPlatformSDK_Request>':
+            nested_class_name = re.match(r'Ref<([^>]*)>', function['return'])[1]
+            nested_class_def = plan['classes'][nested_class_name]
+            if nested_class_def['type'] != 'result' or nested_class_def['is_array']:
+                continue
+            field['ovr_handle'] = nested_class_def['ovr_handle']
+            field['fields'] = get_column_fields(nested_class_def, plan, False)
+            if len(field['fields']) > 0:
+                fields.append(field)
+
+    return fields
+
+
+def get_snapshot_fields(class_name, class_def, plan):
+    """Gets the fields of a result class that are copied into its snapshot, which is every getter without arguments."""
+    fields = []
+    for function_name, function in class_def['functions'].items():
+        if len(function['arguments']) > 0 or function['return'] == 'void':
+            continue
+        if 'exclude_source' in function and function['exclude_source']:
+            continue
+        # Messages only have one valid payload, which is kept in 'data' instead.
+        if class_name == 'MetaPlatformSDK_Message' and function['ovr_function']['name'] in OVR_FUNCTION_TO_MESSAGE_TYPES:
+            continue
+
+        member_name = function_name[4:] if function_name.startswith('get_') else function_name
+        if member_name in CPP_KEYWORDS:
+            member_name += '_'
+        field = {
+            'name': member_name,
+            'type': function['return'],
+            'getter': function_name,
+        }
+
+        m = re.match(r'Ref<([^>]*)>', function['return'])
+        if m:
+            if plan['classes'][m[1]]['type'] != 'result':
+                continue
+            field['nested'] = True
+        fields.append(field)
+
+    for field_type, member_name, getter in SNAPSHOT_EXTRA_FIELDS.get(class_name, []):
+        fields.append({
+            'name': member_name,
+            'type': field_type,
+            'getter': getter,
+        })
+
+    return fields
+
+
+def generate_column_export(class_name, class_def, plan):
+    element_function = class_def['functions']['get_element']
+    element_class_def = plan['classes'][re.match(r'Ref<([^>]*)>', element_function['return'])[1]]
+    size_function = class_def['functions']['size']
+    fields = get_column_fields(element_class_def, plan)
+
+    def convert(field, handle_name, cast_type):
+        value = convert_return_value_from_ovr(f"{field['ovr_function']['name']}({handle_name})", field['ovr_function']['return'], field['type'], plan)
+        if cast_type in ['String', 'bool'] or cast_type.startswith('MetaPlatformSDK::'):
+            return value
+        # Cast numbers explicitly, since types like 'long long' don't convert unambiguously to Variant.
+        return f'({cast_type}){value}'
+
+    def flatten(fields):
+        for field in fields:
+            if 'fields' in field:
+                for nested_field in field['fields']:
+                    yield (field['name'] + '_' + nested_field['name'], nested_field)
+            else:
+                yield (field['name'], field)
+
+    def convert_detached(field, element_name, cast_type):
+        value = f"{element_name}->get_{field['name']}()"
+        if cast_type in ['String', 'bool'] or cast_type.startswith('MetaPlatformSDK::'):
+            return value
+        return f'({cast_type}){value}'
+
+    def append_detached_element(lines, indent, element_name):
+        # Once detached, the element wrappers hold the only copy of the data.
+        lines.append(f"{indent}const {element_function['return']} &{element_name} = elements[i];")
+        lines.append(f'{indent}if ({element_name}.is_null()) {{')
+        lines.append(f'{indent}\tcontinue;')
+        lines.append(f'{indent}}}')
+
+    lines = []
+
+    # Generate to_columns().
+    lines.append(f'Dictionary {class_name}::to_columns() const {{')
+    lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+    lines.append('\tERR_FAIL_COND_V(handle == nullptr && snapshot == nullptr, Dictionary());')
+    lines.append('')
+    lines.append(f"\tsize_t count = snapshot != nullptr ? elements.size() : {size_function['ovr_function']['name']}(handle);")
+    lines.append('')
+    for column_name, field in flatten(fields):
+        packed_type, element_type = field['column_type']
+        lines.append(f'\t{packed_type} {column_name}_column;')
+        lines.append(f'\t{column_name}_column.resize(count);')
+        lines.append(f'\t{element_type} *{column_name}_ptr = {column_name}_column.ptrw();')
+    lines.append('')
+    lines.append('\tfor (size_t i = 0; i < count; i++) {')
+    lines.append('\t\tif (snapshot != nullptr) {')
+    append_detached_element(lines, '\t\t\t', 'element')
+    for field in fields:
+        if 'fields' in field:
+            lines.append(f"\t\t\t{field['type']} {field['name']} = element->get_{field['name']}();")
+            lines.append(f"\t\t\tif ({field['name']}.is_valid()) {{")
+            for nested_field in field['fields']:
+                column_name = field['name'] + '_' + nested_field['name']
+                lines.append(f"\t\t\t\t{column_name}_ptr[i] = {convert_detached(nested_field, field['name'], nested_field['column_type'][1])};")
+            lines.append('\t\t\t}')
+        else:
+            lines.append(f"\t\t\t{field['name']}_ptr[i] = {convert_detached(field, 'element', field['column_type'][1])};")
+    lines.append('\t\t\tcontinue;')
+    lines.append('\t\t}')
+    lines.append('')
+    lines.append(f"\t\t{element_class_def['ovr_handle']} element = {element_function['ovr_function']['name']}(handle, i);")
+    for field in fields:
+        if 'fields' in field:
+            lines.append(f"\t\t{field['ovr_handle']} {field['name']}_handle = {field['ovr_function']['name']}(element);")
+            lines.append(f"\t\tif ({field['name']}_handle != nullptr) {{")
+            for nested_field in field['fields']:
+                column_name = field['name'] + '_' + nested_field['name']
+                lines.append(f"\t\t\t{column_name}_ptr[i] = {convert(nested_field, field['name'] + '_handle', nested_field['column_type'][1])};")
+            lines.append('\t\t}')
+        else:
+            lines.append(f"\t\t{field['name']}_ptr[i] = {convert(field, 'element', field['column_type'][1])};")
+    lines.append('\t}')
+    lines.append('')
+    lines.append('\tDictionary columns;')
+    for field in fields:
+        if 'fields' in field:
+            lines.append(f"\tDictionary {field['name']}_columns;")
+            for nested_field in field['fields']:
+                lines.append(f"\t{field['name']}_columns[\"{nested_field['name']}\"] = {field['name']}_{nested_field['name']}_column;")
+            lines.append(f"\tcolumns[\"{field['name']}\"] = {field['name']}_columns;")
+        else:
+            lines.append(f"\tcolumns[\"{field['name']}\"] = {field['name']}_column;")
+    lines.append('\treturn columns;')
+    lines.append('#else')
+    lines.append('\treturn Dictionary();')
+    lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+    lines.append('}')
+    lines.append('')
+
+    # Generate to_dictionary_array().
+    lines.append(f'TypedArray<Dictionary> {class_name}::to_dictionary_array() const {{')
+    lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+    lines.append('\tERR_FAIL_COND_V(handle == nullptr && snapshot == nullptr, TypedArray<Dictionary>());')
+    lines.append('')
+    lines.append(f"\tsize_t count = snapshot != nullptr ? elements.size() : {size_function['ovr_function']['name']}(handle);")
+    lines.append('')
+    lines.append('\tTypedArray<Dictionary> ret;')
+    lines.append('\tret.resize(count);')
+    lines.append('\tfor (size_t i = 0; i < count; i++) {')
+    lines.append('\t\tif (snapshot != nullptr) {')
+    append_detached_element(lines, '\t\t\t', 'element')
+    lines.append('\t\t\tDictionary entry;')
+    for field in fields:
+        if 'fields' in field:
+            lines.append(f"\t\t\t{field['type']} {field['name']} = element->get_{field['name']}();")
+            lines.append(f"\t\t\tif ({field['name']}.is_valid()) {{")
+            lines.append(f"\t\t\t\tDictionary {field['name']}_entry;")
+            for nested_field in field['fields']:
+                lines.append(f"\t\t\t\t{field['name']}_entry[\"{nested_field['name']}\"] = {convert_detached(nested_field, field['name'], nested_field['type'])};")
+            lines.append(f"\t\t\t\tentry[\"{field['name']}\"] = {field['name']}_entry;")
+            lines.append('\t\t\t} else {')
+            lines.append(f"\t\t\t\tentry[\"{field['name']}\"] = Variant();")
+            lines.append('\t\t\t}')
+        else:
+            lines.append(f"\t\t\tentry[\"{field['name']}\"] = {convert_detached(field, 'element', field['type'])};")
+    lines.append('\t\t\tret[i] = entry;')
+    lines.append('\t\t\tcontinue;')
+    lines.append('\t\t}')
+    lines.append('')
+    lines.append(f"\t\t{element_class_def['ovr_handle']} element = {element_function['ovr_function']['name']}(handle, i);")
+    lines.append('\t\tDictionary entry;')
+    for field in fields:
+        if 'fields' in field:
+            lines.append(f"\t\t{field['ovr_handle']} {field['name']}_handle = {field['ovr_function']['name']}(element);")
+            lines.append(f"\t\tif ({field['name']}_handle != nullptr) {{")
+            lines.append(f"\t\t\tDictionary {field['name']}_entry;")
+            for nested_field in field['fields']:
+                lines.append(f"\t\t\t{field['name']}_entry[\"{nested_field['name']}\"] = {convert(nested_field, field['name'] + '_handle', nested_field['type'])};")
+            lines.append(f"\t\t\tentry[\"{field['name']}\"] = {field['name']}_entry;")
+            lines.append('\t\t} else {')
+            lines.append(f"\t\t\tentry[\"{field['name']}\"] = Variant();")
+            lines.append('\t\t}')
+        else:
+            lines.append(f"\t\tentry[\"{field['name']}\"] = {convert(field, 'element', field['type'])};")
+    lines.append('\t\tret[i] = entry;')
+    lines.append('\t}')
+    lines.append('\treturn ret;')
+    lines.append('#else')
+    lines.append('\treturn TypedArray<Dictionary>();')
+    lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+    lines.append('}')
+    lines.append('')
+
+    return lines
+
+
+def generate_snapshot(class_name, class_def, plan):
+    """Generates _snapshot(), which copies everything out of the handle, so the message can be freed."""
+    lines = []
+
+    lines.append(f'void {class_name}::_snapshot() {{')
+    lines.append('\tif (snapshot != nullptr || handle == nullptr) {')
+    lines.append('\t\treturn;')
+    lines.append('\t}')
+    lines.append('')
+    lines.append('\tSnapshot *new_snapshot = memnew(Snapshot);')
+    for field in get_snapshot_fields(class_name, class_def, plan):
+        lines.append(f"\tnew_snapshot->{field['name']} = {field['getter']}();")
+        if 'nested' in field:
+            lines.append(f"\tif (new_snapshot->{field['name']}.is_valid()) {{")
+            lines.append(f"\t\tnew_snapshot->{field['name']}->_snapshot();")
+            lines.append('\t}')
+    if class_def['is_array']:
+        lines.append('')
+        lines.append(f"\tfor (uint64_t i = 0; i < new_snapshot->size; i++) {{")
+        lines.append(f"\t\t{class_def['functions']['get_element']['return']} element = get_element(i);")
+        lines.append('\t\tif (element.is_valid()) {')
+        lines.append('\t\t\telement->_snapshot();')
+        lines.append('\t\t}')
+        lines.append('\t}')
+    if class_name == 'MetaPlatformSDK_Message':
+        lines.append('')
+        lines.append('\tif (!new_snapshot->is_error && type != MetaPlatformSDK::MessageType::MESSAGE_UNKNOWN) {')
+        lines.append('\t\tget_data();')
+        lines.append('\t\t_snapshot_data();')
+        lines.append('\t}')
+    lines.append('')
+    lines.append('\tsnapshot = new_snapshot;')
+    if 'free_func' in class_def:
+        lines.append(f"\t{class_def['free_func']['name']}(handle);")
+    lines.append('\thandle = nullptr;')
+    lines.append('}')
+    lines.append('')
+
+    if class_name == 'MetaPlatformSDK_Message':
+        lines.append('void MetaPlatformSDK_Message::_snapshot_data() {')
+        lines.append('\tswitch (type) {')
+        for ovr_function, ovr_types in OVR_FUNCTION_TO_MESSAGE_TYPES.items():
+            if ovr_function not in class_def['function_map']:
+                continue
+            data_class_name = re.match(r'Ref<([^>]*)>', class_def['functions'][class_def['function_map'][ovr_function]]['return'])
+            if not data_class_name:
+                continue
+            for ovr_type in ovr_types:
+                type_name = plan['enums']['MessageType']['value_map'][ovr_type]
+                lines.append(f'\t\tcase MetaPlatformSDK::MessageType::{type_name}:')
+            lines.append('\t\t{')
+            lines.append(f'\t\t\tRef<{data_class_name[1]}> value = data;')
+            lines.append('\t\t\tif (value.is_valid()) {')
+            lines.append('\t\t\t\tvalue->_snapshot();')
+            lines.append('\t\t\t}')
+            lines.append('\t\t} break;')
+            lines.append('')
+        lines.append('\t\tdefault:')
+        lines.append('\t\t\tbreak;')
+        lines.append('\t}')
+        lines.append('}')
+        lines.append('')
+
+    return lines
+
+
+# Multiplier for the Fibonacci hash into MESSAGE_TYPE_SLOTS (2^32 divided by the golden ratio).
+MESSAGE_TYPE_HASH_MULTIPLIER = 2654435761
+
+
+def get_message_payload_name(ovr_function, class_def):
+    """Gets the name of the MessagePayload constant for the payload returned by an OVR message function."""
+    if ovr_function == '!ovr_Message_IsError':
+        return 'MESSAGE_PAYLOAD_IS_SUCCESS'
+    return 'MESSAGE_PAYLOAD_' + class_def['function_map'][ovr_function].upper()
+
+
+def get_message_payloads(class_def):
+    """Lists the payloads of the selected message types, in the order of OVR_FUNCTION_TO_MESSAGE_TYPES."""
+    payloads = []
+    for ovr_function, ovr_types in OVR_FUNCTION_TO_MESSAGE_TYPES.items():
+        # Payloads of the Platform SDK modules that weren't selected.
+        if ovr_function != '!ovr_Message_IsError' and ovr_function not in class_def['function_map']:
+            continue
+        payloads.append((get_message_payload_name(ovr_function, class_def), ovr_function, ovr_types))
+    return payloads
+
+
+def generate_message_type_tables(class_def, plan):
+    """Generates constant tables indexed by message type, so lookups don't need to switch over the sparse hash values."""
+    lines = []
+
+    message_types = plan['enums']['MessageType']['values']
+    payloads = get_message_payloads(class_def)
+    type_payloads = {}
+    for payload_name, ovr_function, ovr_types in payloads:
+        for ovr_type in ovr_types:
+            type_payloads[plan['enums']['MessageType']['value_map'][ovr_type]] = payload_name
+
+    # Open addressing with linear probing, in a table at most half full.
+    slot_bits = 1
+    while (1 << slot_bits) < len(message_types) * 2:
+        slot_bits += 1
+    slot_shift = 32 - slot_bits
+    slots = [0] * (1 << slot_bits)
+    max_probes = 0
+    for index, value in enumerate(message_types):
+        slot = ((int(value['value'], 0) * MESSAGE_TYPE_HASH_MULTIPLIER) & 0xFFFFFFFF) >> slot_shift
+        probes = 1
+        while slots[slot] != 0:
+            slot = (slot + 1) & ((1 << slot_bits) - 1)
+            probes += 1
+        slots[slot] = index + 1
+        max_probes = max(max_probes, probes)
+
+    lines.append('static constexpr uint32_t MESSAGE_TYPES[] = {')
+    for value in message_types:
+        lines.append(f'\t{value["value"]}, // {value["name"]}')
+    lines.append('};')
+    lines.append('')
+    lines.append('static constexpr const char *MESSAGE_TYPE_NAMES[] = {')
+    for value in message_types:
+        lines.append(f'\t"{value["name"]}",')
+    lines.append('};')
+    lines.append('')
+
+    lines.append(f'// Indexes into MESSAGE_TYPES plus one, or zero for an empty slot. Lookups take at most {max_probes} probes.')
+    lines.append(f'static constexpr uint32_t MESSAGE_TYPE_SLOT_SHIFT = {slot_shift};')
+    lines.append(f'static constexpr uint32_t MESSAGE_TYPE_SLOT_MASK = {(1 << slot_bits) - 1};')
+    lines.append('static constexpr uint16_t MESSAGE_TYPE_SLOTS[] = {')
+    for i in range(0, len(slots), 16):
+        lines.append('\t' + ', '.join(str(slot) for slot in slots[i:i + 16]) + ',')
+    lines.append('};')
+    lines.append('')
+
+    lines.append('static int32_t _get_message_type_index(MetaPlatformSDK::MessageType p_type) {')
+    lines.append(f'\tuint32_t slot = ((uint32_t)p_type * {MESSAGE_TYPE_HASH_MULTIPLIER}u) >> MESSAGE_TYPE_SLOT_SHIFT;')
+    lines.append('\twhile (MESSAGE_TYPE_SLOTS[slot] != 0) {')
+    lines.append('\t\tint32_t index = MESSAGE_TYPE_SLOTS[slot] - 1;')
+    lines.append('\t\tif (MESSAGE_TYPES[index] == (uint32_t)p_type) {')
+    lines.append('\t\t\treturn index;')
+    lines.append('\t\t}')
+    lines.append('\t\tslot = (slot + 1) & MESSAGE_TYPE_SLOT_MASK;')
+    lines.append('\t}')
+    lines.append('\treturn -1;')
+    lines.append('}')
+    lines.append('')
+    lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+    lines.append('enum MessagePayload : uint8_t {')
+    lines.append('\tMESSAGE_PAYLOAD_NONE,')
+    for payload_name, _, _ in payloads:
+        lines.append(f'\t{payload_name},')
+    lines.append('};')
+    lines.append('')
+
+    lines.append('static constexpr MessagePayload MESSAGE_TYPE_PAYLOADS[] = {')
+    for value in message_types:
+        lines.append(f'\t{type_payloads.get(value["name"], "MESSAGE_PAYLOAD_NONE")}, // {value["name"]}')
+    lines.append('};')
+    lines.append('')
+    lines.append('static MessagePayload _get_message_payload(MetaPlatformSDK::MessageType p_type) {')
+    lines.append('\tint32_t index = _get_message_type_index(p_type);')
+    lines.append('\treturn index >= 0 ? MESSAGE_TYPE_PAYLOADS[index] : MESSAGE_PAYLOAD_NONE;')
+    lines.append('}')
+    lines.append('')
+
+    lines.append('typedef Variant (*MessagePayloadDecoder)(const MetaPlatformSDK_Message *p_message);')
+    lines.append('')
+    lines.append('static constexpr MessagePayloadDecoder MESSAGE_PAYLOAD_DECODERS[] = {')
+    lines.append('\tnullptr, // MESSAGE_PAYLOAD_NONE')
+    for payload_name, ovr_function, _ in payloads:
+        if ovr_function == '!ovr_Message_IsError':
+            call = 'is_success'
+        else:
+            call = class_def['function_map'][ovr_function]
+        lines.append(f'\t[](const MetaPlatformSDK_Message *p_message) -> Variant {{ return p_message->{call}(); }}, // {payload_name}')
+    lines.append('};')
+    lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+    lines.append('')
+
+    return lines
+
+
+def generate_message_get_data_switch(function_name, class_def, plan):
+    """Generates the switch-based MetaPlatformSDK_Message::get_data(), kept to benchmark the tables against."""
+    lines = []
+
+    lines.append(f'Variant MetaPlatformSDK_Message::{function_name}() const {{')
+    lines.append('\tERR_FAIL_COND_V(type == MetaPlatformSDK::MessageType::MESSAGE_UNKNOWN, Variant());')
+    lines.append('')
+    lines.append('\tif (data.get_type() != Variant::NIL) {')
+    lines.append('\t\treturn data;')
+    lines.append('\t}')
+    lines.append('')
+    lines.append('\tswitch (type) {')
+    for _, ovr_function, ovr_types in get_message_payloads(class_def):
+        for ovr_type in ovr_types:
+            type_name = plan['enums']['MessageType']['value_map'][ovr_type]
+            lines.append(f'\t\tcase MetaPlatformSDK::MessageType::{type_name}:')
+        if ovr_function == '!ovr_Message_IsError':
+            lines.append('\t\t\tdata = is_success();')
+        else:
+            lines.append(f"\t\t\t{class_def['function_map'][ovr_function]}();")
+        lines.append('\t\t\tbreak;')
+        lines.append('')
+    lines.append('\t\tdefault:')
+    lines.append('\t\t\tERR_PRINT(vformat("MetaPlatformSDK_Message: Cannot get data for unknown message type %s", type));')
+    lines.append('\t}')
+    lines.append('')
+    lines.append('\treturn data;')
+    lines.append('}')
+    lines.append('')
+
+    return lines
+
+
+def is_coalescable(function_name, function):
+    """Checks if identical calls to this singleton function can share a single in-flight request."""
+    if function['return'] != 'Ref<MetaPlatformSDK_Request>' or function_name in COALESCE_EXCLUDE:
+        return False
+    if not re.search(r'_(get|status|check)_', function_name):
+        return False
+    # Only arguments we can compare by value.
+    for argument in function['arguments']:
+        if argument['type'].startswith('const Ref<'):
+            return False
+    return True
+
+
+def get_next_page_function(class_name, plan):
+    """Gets the singleton function that requests the page after the given array, if it's paginated."""
+    class_def = plan['classes'][class_name]
+    if class_def['type'] != 'result' or not class_def['is_array'] or 'has_next_page' not in class_def['functions']:
+        return None
+
+    for function_name, function in plan['classes']['MetaPlatformSDK']['functions'].items():
+        if '_get_next_' not in function_name or len(function['arguments']) != 1:
+            continue
+        if function['arguments'][0]['type'] == f'const Ref<{class_name}> &':
+            return function_name
+
+    return None
+
+
 def generate_header(class_name, class_def, plan):
     lines = []
 
@@ -1041,20 +1803,40 @@ def generate_header(class_name, class_def, plan):
 
     if class_name != 'MetaPlatformSDK':
         lines.append('#include "platform_sdk/meta_platform_sdk.h"')
+        lines.append('#include "platform_sdk/meta_platform_sdk_allocation_counter.h"')
+        if class_def['type'] == 'result':
+            lines.append('#include "platform_sdk/meta_platform_sdk_object_pool.h"')
+        if class_name in BYTE_BUFFER_CLASSES:
+            lines.append('#include "platform_sdk/meta_platform_sdk_byte_buffer.h"')
+        if class_name == 'MetaPlatformSDK_Message' or get_next_page_function(class_name, plan):
+            lines.append('#include "platform_sdk/meta_platform_sdk_pager.h"')
+        if class_def['type'] == 'result' and class_def['is_array']:
+            lines.append('')
+            lines.append('#include <godot_cpp/variant/typed_array.hpp>')
         lines.append('')
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         for ovr_header in class_def['ovr_headers']:
             lines.append(f'#include <{ovr_header}>')
-        lines.append('#endif // ANDROID_ENABLED')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
     else:
         lines.append('#include <godot_cpp/classes/ref.hpp>')
         lines.append('#include <godot_cpp/templates/hash_map.hpp>')
+        lines.append('#include <godot_cpp/templates/local_vector.hpp>')
         lines.append('')
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+        lines.append('#include <OVR_Message.h>')
         lines.append('#include <OVR_Types.h>')
-        lines.append('#endif // ANDROID_ENABLED')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
         lines.append('')
+        lines.append('#include "platform_sdk/meta_platform_sdk_http_transfer_sink.h"')
+        lines.append('#include "platform_sdk/meta_platform_sdk_latency_histogram.h"')
         lines.append('#include "platform_sdk/meta_platform_sdk_request.h"')
+        lines.append('#include "platform_sdk/meta_platform_sdk_request_coalescer.h"')
+        lines.append('#include "platform_sdk/meta_platform_sdk_request_table.h"')
+        lines.append('')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+        lines.append('#include "platform_sdk/meta_platform_sdk_message_thread.h"')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
     lines.append('')
 
     # Dependencies.
@@ -1083,15 +1865,71 @@ def generate_header(class_name, class_def, plan):
     if class_def['type'] == 'singleton':
         lines.append(f'\tstatic {class_name} *singleton;')
         lines.append('')
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('\tbool message_pump_automatic = true;')
+        lines.append('\tbool message_pump_threaded = false;')
+        lines.append('\tint64_t message_pump_time_budget_usec = 0;')
+        lines.append('\tint32_t message_pump_max_messages = 0;')
+        lines.append('\tbool _pumping_messages = false;')
+        lines.append('\tuint32_t _last_pump_popped = 0;')
+        lines.append('\tuint32_t _last_pump_dispatched = 0;')
+        lines.append('\tuint32_t _last_pump_deferred = 0;')
+        lines.append('\tuint64_t _last_pump_usec = 0;')
+        lines.append('\tdouble request_default_timeout = 0.0;')
+        lines.append('\tdouble request_stale_threshold = 0.0;')
+        lines.append('\tbool request_coalescing = false;')
+        lines.append('\tuint64_t _last_request_sweep_usec = 0;')
+        lines.append('\tbool performance_monitors_enabled = true;')
+        lines.append('\tbool detach_messages = false;')
+        lines.append('\tbool notification_coalescing = false;')
+        lines.append('\tuint32_t _last_pump_coalesced = 0;')
+        lines.append('\tLocalVector<StringName> _performance_monitors;')
+        lines.append('\tHashMap<uint64_t, Ref<MetaPlatformSDK_HttpTransferSink>> http_transfer_sinks;')
+        lines.append('')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         lines.append('\tbool _platform_initialized = false;')
-        lines.append('\tHashMap<ovrRequest, Ref<MetaPlatformSDK_Request>> requests;')
-        lines.append('#endif // ANDROID_ENABLED')
+        lines.append('\tMetaPlatformSDKRequestTable requests;')
+        lines.append('\tMetaPlatformSDKRequestCoalescer request_coalescer;')
+        lines.append('\t// Coalesced requests given a timeout of their own, since they aren\'t in the request table.')
+        lines.append('\tstruct CoalescedTimeout {')
+        lines.append('\t\tRef<MetaPlatformSDK_Request> request;')
+        lines.append('\t\tuint64_t deadline_usec = 0;')
+        lines.append('\t};')
+        lines.append('\tLocalVector<CoalescedTimeout> coalesced_timeouts;')
+        lines.append('\tMetaPlatformSDKLatencyStats request_latencies;')
+        lines.append('\tLocalVector<MetaPlatformSDKPendingMessage> pending_messages;')
+        lines.append('\tuint32_t pending_messages_head = 0;')
+        lines.append('\tMetaPlatformSDKMessageThread message_thread;')
+        lines.append('')
+        lines.append(f"\tstatic const int32_t NOTIFICATION_TYPE_COUNT = {max(len(plan['notification_types']), 1)};")
+        lines.append('\tstruct NotificationHandler {')
+        lines.append('\t\tCallable callable;')
+        lines.append('\t\tuint64_t filter_id = 0;')
+        lines.append('\t\tbool has_filter = false;')
+        lines.append('\t};')
+        lines.append('\tLocalVector<NotificationHandler> notification_handlers[NOTIFICATION_TYPE_COUNT];')
+        lines.append('\tint32_t _dispatching_notification_index = -1;')
+        lines.append('\tbool _notification_handlers_dirty = false;')
+        lines.append('\tHashMap<int32_t, uint64_t> coalesced_notifications;')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
         lines.append('')
     else:
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         lines.append(f'\t{class_def["ovr_handle"]} handle = nullptr;')
-        lines.append('#endif // ANDROID_ENABLED')
+        if class_def['type'] == 'result' and class_def['is_array']:
+            # Element wrappers are created on first access, and reused after that.
+            lines.append(f"\tmutable LocalVector<{class_def['functions']['get_element']['return']}> elements;")
+        if class_def['type'] == 'result':
+            # Once detached from its message, the getters read from here instead of the handle.
+            lines.append('\tstruct Snapshot {')
+            for field in get_snapshot_fields(class_name, class_def, plan):
+                lines.append(f"\t\t{field['type']} {field['name']} = {{}};")
+            lines.append('\t};')
+            lines.append('\tSnapshot *snapshot = nullptr;')
+            lines.append('')
+            lines.append(f'\tstatic MetaPlatformSDKObjectPool<{class_name}> _pool;')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+        lines.append('')
+        lines.append('\tstatic MetaPlatformSDKAllocationCounter _allocation_counter;')
         lines.append('')
     if class_name == 'MetaPlatformSDK_Message':
         lines.append('\tMetaPlatformSDK::MessageType type = MetaPlatformSDK::MESSAGE_UNKNOWN;')
@@ -1129,28 +1967,109 @@ def generate_header(class_name, class_def, plan):
     if class_name == 'MetaPlatformSDK':
         lines.append(f'\tstatic void _register_generated_classes();')
         lines.append('')
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         lines.append(f'\tvoid _initialize_platform();')
         lines.append(f'\tvoid _initialize_platform_async(const Ref<MetaPlatformSDK_Message> &p_message);')
-        lines.append(f'\tRef<MetaPlatformSDK_Request> _create_request(ovrRequest p_request);')
+        lines.append(f'\tRef<MetaPlatformSDK_Request> _create_request(ovrRequest p_request, const String &p_coalesce_key = String());')
+        lines.append(f'\tRef<MetaPlatformSDK_Request> _join_coalesced_request(const String &p_api, const Array &p_args, String &r_key);')
         lines.append(f'\tvoid _process_messages();')
-        lines.append('#endif // ANDROID_ENABLED')
+        lines.append(f'\tRef<MetaPlatformSDK_Message> _get_pending_message(const MetaPlatformSDKPendingMessage &p_pending);')
+        lines.append(f'\tvoid _dispatch_message(MetaPlatformSDKPendingMessage &p_pending);')
+        lines.append(f'\tvoid _drain_message_thread();')
+        lines.append(f'\tvoid _cancel_request(MetaPlatformSDK_Request *p_request);')
+        lines.append(f'\tvoid _set_request_timeout(MetaPlatformSDK_Request *p_request, double p_seconds);')
+        lines.append(f'\tvoid _release_coalesced_request(MetaPlatformSDK_Request *p_request);')
+        lines.append(f'\tvoid _sweep_requests(uint64_t p_now_usec);')
+        lines.append(f'\tbool _dispatch_http_transfer(ovrMessageHandle p_message);')
+        lines.append(f'\tvoid _sweep_http_transfer_sinks(uint64_t p_now_usec);')
+        lines.append(f'\tvoid _add_request_latency_monitors(int32_t p_message_type);')
+        lines.append(f'\tvoid _call_notification_handlers(int32_t p_index, bool p_has_filter_id, uint64_t p_filter_id, const Ref<MetaPlatformSDK_Message> &p_message);')
+        lines.append(f'\tstatic int32_t _get_notification_index(ovrMessageType p_type);')
+        lines.append(f'\tstatic bool _is_notification_filterable(ovrMessageType p_type);')
+        lines.append(f'\tstatic bool _get_notification_filter_id(ovrMessageHandle p_message, ovrMessageType p_type, uint64_t &r_filter_id);')
+        lines.append(f'\tstatic bool _get_notification_coalesce_key(ovrMessageHandle p_message, ovrMessageType p_type, uint64_t &r_key);')
+        lines.append(f'\tvoid _coalesce_pending_messages();')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+        lines.append(f'\tvoid _add_performance_monitors();')
+        lines.append(f'\tvoid _remove_performance_monitors();')
+        lines.append(f'\tdouble _get_monitor_value(int32_t p_monitor) const;')
+        lines.append(f'\tdouble _get_request_latency_monitor_value(int32_t p_message_type, double p_fraction) const;')
         lines.append('')
         lines.append(f'\tPlatformInitializeResult initialize_platform(const String &p_app_id, const Dictionary &p_options);')
         lines.append(f'\tRef<MetaPlatformSDK_Request> initialize_platform_async(const String &p_app_id);')
+        lines.append('')
+        lines.append(f'\tvoid set_message_pump_automatic(bool p_enable);')
+        lines.append(f'\tbool is_message_pump_automatic() const;')
+        lines.append(f'\tvoid set_message_pump_threaded(bool p_enable);')
+        lines.append(f'\tbool is_message_pump_threaded() const;')
+        lines.append(f'\tvoid set_message_pump_time_budget_usec(int64_t p_usec);')
+        lines.append(f'\tint64_t get_message_pump_time_budget_usec() const;')
+        lines.append(f'\tvoid set_message_pump_max_messages(int32_t p_max_messages);')
+        lines.append(f'\tint32_t get_message_pump_max_messages() const;')
+        lines.append(f'\tint32_t pump_messages();')
+        lines.append(f'\tDictionary get_message_pump_stats() const;')
+        lines.append('')
+        lines.append(f'\tvoid set_request_default_timeout(double p_seconds);')
+        lines.append(f'\tdouble get_request_default_timeout() const;')
+        lines.append(f'\tvoid set_request_stale_threshold(double p_seconds);')
+        lines.append(f'\tdouble get_request_stale_threshold() const;')
+        lines.append(f'\tint32_t get_pending_request_count() const;')
+        lines.append(f'\tvoid set_request_coalescing(bool p_enable);')
+        lines.append(f'\tbool is_request_coalescing() const;')
+        lines.append(f'\tDictionary get_request_coalescing_stats() const;')
+        lines.append(f'\tDictionary get_request_latency_stats() const;')
+        lines.append(f'\tDictionary get_allocation_stats() const;')
+        lines.append(f'\tvoid reset_request_latency_stats();')
+        lines.append(f'\tvoid set_detach_messages(bool p_enable);')
+        lines.append(f'\tbool is_detach_messages() const;')
+        lines.append(f'\tvoid set_notification_coalescing(bool p_enable);')
+        lines.append(f'\tbool is_notification_coalescing() const;')
+        lines.append(f'\tDictionary get_notification_coalescing_stats() const;')
+        lines.append(f'\tvoid set_string_cache_size(int32_t p_size);')
+        lines.append(f'\tint32_t get_string_cache_size() const;')
+        lines.append(f'\tvoid set_object_pool_size(int32_t p_size);')
+        lines.append(f'\tint32_t get_object_pool_size() const;')
+        lines.append(f'\tDictionary get_string_cache_stats() const;')
+        lines.append(f'\tvoid clear_string_cache();')
+        lines.append(f'\tvoid set_performance_monitors_enabled(bool p_enable);')
+        lines.append(f'\tbool is_performance_monitors_enabled() const;')
+        lines.append('')
+        lines.append(f'\tvoid register_http_transfer_sink(uint64_t p_transfer_id, const Ref<MetaPlatformSDK_HttpTransferSink> &p_sink);')
+        lines.append(f'\tvoid unregister_http_transfer_sink(uint64_t p_transfer_id);')
+        lines.append(f'\tvoid register_notification_handler(MessageType p_type, const Callable &p_handler, const Variant &p_filter_id);')
+        lines.append(f'\tvoid unregister_notification_handler(MessageType p_type, const Callable &p_handler, const Variant &p_filter_id);')
     else:
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         lines.append(f'\tstatic Ref<{class_name}> _create_with_ovr_handle({class_def["ovr_handle"]} p_handle);')
+        if class_name == 'MetaPlatformSDK_Message':
+            lines.append(f'\tstatic Ref<{class_name}> _create_with_ovr_handle({class_def["ovr_handle"]} p_handle, MetaPlatformSDK::MessageType p_type, const Variant &p_data);')
+            lines.append('\tvoid _predecode_data();')
         lines.append(f'\tinline {class_def["ovr_handle"]} _get_ovr_handle() {{ return handle; }}')
-        lines.append('#endif // ANDROID_ENABLED')
+        if class_def['type'] == 'result':
+            lines.append('\tvoid _snapshot();')
+            lines.append('\tvoid _recycle();')
+        if class_name == 'MetaPlatformSDK_Message':
+            lines.append('\tvoid _snapshot_data();')
+            lines.append('\tbool _has_next_page() const;')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
         lines.append('')
     if class_name == 'MetaPlatformSDK_Message':
+        lines.append('\tvoid detach();')
+        lines.append('\tbool is_detached() const;')
         lines.append('\tinline MetaPlatformSDK::MessageType get_type() const { return type; }')
         lines.append('\tVariant get_data() const;')
         lines.append('\tbool is_success() const { return !is_error(); }')
         lines.append('\tbool is_notification() const;')
         lines.append('\tuint64_t get_request_id() const;')
         lines.append('\tString get_type_as_string() const;')
+        lines.append('\tRef<MetaPlatformSDK_Pager> create_pager();')
+        lines.append('')
+        lines.append('#ifdef META_TOOLKIT_BENCHMARKS_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+        lines.append('\tVariant _get_data_with_switch() const;')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+        lines.append('\tString _get_type_as_string_with_switch() const;')
+        lines.append('#endif // META_TOOLKIT_BENCHMARKS_ENABLED')
         lines.append('')
     if class_name == 'MetaPlatformSDK_HttpTransferUpdate':
         lines.append('\tuint64_t get_id() const;')
@@ -1161,6 +2080,9 @@ def generate_header(class_name, class_def, plan):
     if class_name == 'MetaPlatformSDK_LeaderboardEntry':
         lines.append('\tPackedByteArray get_extra_data() const;')
         lines.append('')
+    if class_name in BYTE_BUFFER_CLASSES:
+        lines.append(f'\tint64_t {BYTE_BUFFER_CLASSES[class_name]}_into(const Ref<MetaPlatformSDK_ByteBuffer> &p_buffer, int64_t p_offset) const;')
+        lines.append('')
 
     # Iterator functions for arrays.
     if class_def['type'] == 'result' and class_def['is_array']:
@@ -1168,6 +2090,12 @@ def generate_header(class_name, class_def, plan):
         lines.append('\tbool _iter_next(Array p_iter);')
         lines.append('\tVariant _iter_get(uint64_t p_iter);')
         lines.append('')
+        lines.append('\tDictionary to_columns() const;')
+        lines.append('\tTypedArray<Dictionary> to_dictionary_array() const;')
+        lines.append('')
+        if get_next_page_function(class_name, plan):
+            lines.append('\tstatic const MetaPlatformSDK_Pager::PageFuncs _pager_funcs;')
+            lines.append('')
 
     # Generated functions.
     for func_name, func_def in class_def['functions'].items():
@@ -1196,17 +2124,20 @@ def generate_source(class_name, class_def, plan):
 
     lines.append(f'#include "platform_sdk/{camel_to_snake_case(class_name)}.h"')
     lines.append('')
+    lines.append('#include "platform_sdk/meta_platform_sdk_binding_table.h"')
+    lines.append('#include "platform_sdk/meta_platform_sdk_string_cache.h"')
     lines.append('#include "util.h"')
     lines.append('')
     lines.append('#include <godot_cpp/core/class_db.hpp>')
+    lines.append('#include <godot_cpp/variant/typed_array.hpp>')
     lines.append('#include <godot_cpp/variant/utility_functions.hpp>')
 
     if class_name == 'MetaPlatformSDK':
         lines.append('')
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         for ovr_header in class_def['ovr_headers']:
             lines.append(f'#include <{ovr_header}>')
-        lines.append('#endif // ANDROID_ENABLED')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
         lines.append('')
 
         # Include all the other classes so we can register them.
@@ -1215,10 +2146,12 @@ def generate_source(class_name, class_def, plan):
                 continue
             lines.append(f'#include "platform_sdk/{camel_to_snake_case(other_class_name)}.h"')
     elif class_name == 'MetaPlatformSDK_Message':
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         # Needed for ovr_FreeMessage().
         lines.append(f'#include <OVR_Platform.h>')
-        lines.append('#endif // ANDROID_ENABLED')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+        lines.append('')
+        lines += generate_message_type_tables(class_def, plan)
 
     lines.append('')
 
@@ -1236,30 +2169,81 @@ def generate_source(class_name, class_def, plan):
 
     # Generate _bind_methods().
     lines.append(f'void {class_name}::_bind_methods() {{')
-    for function_name, function in class_def['functions'].items():
-        bind_string = f'\tClassDB::bind_method(D_METHOD("{function_name}"'
-        if len(function['arguments']) > 0:
-            friendly_arg_names = ['"' + a['name'][2:] + '"' for a in function['arguments']]
-            bind_string += ", " + ", ".join(friendly_arg_names)
-        bind_string += f'), &{class_name}::{function_name});'
-        lines.append(bind_string)
-        # Add properties on most result classes.
-        if class_def['type'] == 'result' and class_name != 'MetaPlatformSDK_Message' and function_name.startswith('get_') and len(function['arguments']) == 0:
-            prop_name = function_name[4:]
-            prop_info = make_property_info_from_return_type(prop_name, function['return'], plan)
-            lines.append(f'\tADD_PROPERTY(PropertyInfo({prop_info}), "", "{function_name}");')
+    table_lines, remaining_functions = generate_bind_tables(class_name, class_def, plan)
+    lines += table_lines
+    for function_name, function in remaining_functions.items():
+        friendly_arg_names = ['"' + a['name'][2:] + '"' for a in function['arguments']]
+        lines.append(f'\tClassDB::bind_method(D_METHOD("{function_name}", {", ".join(friendly_arg_names)}), &{class_name}::{function_name});')
     if 'local_enums' in class_def:
         for enum_name in class_def['local_enums']:
             enum = plan['enums'][enum_name]
+            table_name = camel_to_snake_case(enum_name) + '_constants'
+            lines.append(f'\tstatic constexpr MetaPlatformSDKConstantBinding {table_name}[] = {{')
             for enum_value in enum['values']:
-                lines.append(f'\tBIND_ENUM_CONSTANT({enum_value["name"]});')
+                lines.append(f'\t\t{{ "{enum_value["name"]}", {enum_value["name"]} }},')
+            lines.append('\t};')
+            lines.append(f'\tmeta_platform_sdk_bind_enum(get_class_static(), "{enum_name}", {table_name}, std::size({table_name}));')
     if class_name == 'MetaPlatformSDK':
         lines.append('\tClassDB::bind_method(D_METHOD("initialize_platform", "app_id", "options"), &MetaPlatformSDK::initialize_platform, DEFVAL(Dictionary()));')
         lines.append('\tClassDB::bind_method(D_METHOD("initialize_platform_async", "app_id"), &MetaPlatformSDK::initialize_platform_async);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_message_pump_automatic", "enable"), &MetaPlatformSDK::set_message_pump_automatic);')
+        lines.append('\tClassDB::bind_method(D_METHOD("is_message_pump_automatic"), &MetaPlatformSDK::is_message_pump_automatic);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_message_pump_threaded", "enable"), &MetaPlatformSDK::set_message_pump_threaded);')
+        lines.append('\tClassDB::bind_method(D_METHOD("is_message_pump_threaded"), &MetaPlatformSDK::is_message_pump_threaded);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_message_pump_time_budget_usec", "usec"), &MetaPlatformSDK::set_message_pump_time_budget_usec);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_message_pump_time_budget_usec"), &MetaPlatformSDK::get_message_pump_time_budget_usec);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_message_pump_max_messages", "max_messages"), &MetaPlatformSDK::set_message_pump_max_messages);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_message_pump_max_messages"), &MetaPlatformSDK::get_message_pump_max_messages);')
+        lines.append('\tClassDB::bind_method(D_METHOD("pump_messages"), &MetaPlatformSDK::pump_messages);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_message_pump_stats"), &MetaPlatformSDK::get_message_pump_stats);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_request_default_timeout", "seconds"), &MetaPlatformSDK::set_request_default_timeout);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_request_default_timeout"), &MetaPlatformSDK::get_request_default_timeout);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_request_stale_threshold", "seconds"), &MetaPlatformSDK::set_request_stale_threshold);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_request_stale_threshold"), &MetaPlatformSDK::get_request_stale_threshold);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_pending_request_count"), &MetaPlatformSDK::get_pending_request_count);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_request_coalescing", "enable"), &MetaPlatformSDK::set_request_coalescing);')
+        lines.append('\tClassDB::bind_method(D_METHOD("is_request_coalescing"), &MetaPlatformSDK::is_request_coalescing);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_request_coalescing_stats"), &MetaPlatformSDK::get_request_coalescing_stats);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_request_latency_stats"), &MetaPlatformSDK::get_request_latency_stats);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_allocation_stats"), &MetaPlatformSDK::get_allocation_stats);')
+        lines.append('\tClassDB::bind_method(D_METHOD("reset_request_latency_stats"), &MetaPlatformSDK::reset_request_latency_stats);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_detach_messages", "enable"), &MetaPlatformSDK::set_detach_messages);')
+        lines.append('\tClassDB::bind_method(D_METHOD("is_detach_messages"), &MetaPlatformSDK::is_detach_messages);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_notification_coalescing", "enable"), &MetaPlatformSDK::set_notification_coalescing);')
+        lines.append('\tClassDB::bind_method(D_METHOD("is_notification_coalescing"), &MetaPlatformSDK::is_notification_coalescing);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_notification_coalescing_stats"), &MetaPlatformSDK::get_notification_coalescing_stats);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_string_cache_size", "size"), &MetaPlatformSDK::set_string_cache_size);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_string_cache_size"), &MetaPlatformSDK::get_string_cache_size);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_string_cache_stats"), &MetaPlatformSDK::get_string_cache_stats);')
+        lines.append('\tClassDB::bind_method(D_METHOD("clear_string_cache"), &MetaPlatformSDK::clear_string_cache);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_object_pool_size", "size"), &MetaPlatformSDK::set_object_pool_size);')
+        lines.append('\tClassDB::bind_method(D_METHOD("get_object_pool_size"), &MetaPlatformSDK::get_object_pool_size);')
+        lines.append('\tClassDB::bind_method(D_METHOD("set_performance_monitors_enabled", "enable"), &MetaPlatformSDK::set_performance_monitors_enabled);')
+        lines.append('\tClassDB::bind_method(D_METHOD("is_performance_monitors_enabled"), &MetaPlatformSDK::is_performance_monitors_enabled);')
+        lines.append('\tClassDB::bind_method(D_METHOD("register_http_transfer_sink", "transfer_id", "sink"), &MetaPlatformSDK::register_http_transfer_sink);')
+        lines.append('\tClassDB::bind_method(D_METHOD("unregister_http_transfer_sink", "transfer_id"), &MetaPlatformSDK::unregister_http_transfer_sink);')
+        lines.append('\tClassDB::bind_method(D_METHOD("register_notification_handler", "type", "handler", "filter_id"), &MetaPlatformSDK::register_notification_handler, DEFVAL(Variant()));')
+        lines.append('\tClassDB::bind_method(D_METHOD("unregister_notification_handler", "type", "handler", "filter_id"), &MetaPlatformSDK::unregister_notification_handler, DEFVAL(Variant()));')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::BOOL, "message_pump_automatic"), "set_message_pump_automatic", "is_message_pump_automatic");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::BOOL, "message_pump_threaded"), "set_message_pump_threaded", "is_message_pump_threaded");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::INT, "message_pump_time_budget_usec", PROPERTY_HINT_RANGE, "0,100000,1,or_greater,suffix:usec"), "set_message_pump_time_budget_usec", "get_message_pump_time_budget_usec");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::INT, "message_pump_max_messages", PROPERTY_HINT_RANGE, "0,1000,1,or_greater"), "set_message_pump_max_messages", "get_message_pump_max_messages");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::FLOAT, "request_default_timeout", PROPERTY_HINT_RANGE, "0,300,0.1,or_greater,suffix:s"), "set_request_default_timeout", "get_request_default_timeout");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::FLOAT, "request_stale_threshold", PROPERTY_HINT_RANGE, "0,600,0.1,or_greater,suffix:s"), "set_request_stale_threshold", "get_request_stale_threshold");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::BOOL, "request_coalescing"), "set_request_coalescing", "is_request_coalescing");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::BOOL, "detach_messages"), "set_detach_messages", "is_detach_messages");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::BOOL, "notification_coalescing"), "set_notification_coalescing", "is_notification_coalescing");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::INT, "string_cache_size", PROPERTY_HINT_RANGE, "0,65536,1,or_greater"), "set_string_cache_size", "get_string_cache_size");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::INT, "object_pool_size", PROPERTY_HINT_RANGE, "0,4096,1,or_greater"), "set_object_pool_size", "get_object_pool_size");')
+        lines.append('\tADD_PROPERTY(PropertyInfo(Variant::BOOL, "performance_monitors_enabled"), "set_performance_monitors_enabled", "is_performance_monitors_enabled");')
         lines.append('\tADD_SIGNAL(MethodInfo("notification_received", PropertyInfo(Variant::OBJECT, "message", PROPERTY_HINT_RESOURCE_TYPE, "MetaPlatformSDK_Message")));')
+        lines.append('\tADD_SIGNAL(MethodInfo("request_stale", PropertyInfo(Variant::OBJECT, "request", PROPERTY_HINT_RESOURCE_TYPE, "MetaPlatformSDK_Request")));')
     elif class_name == 'MetaPlatformSDK_Message':
         lines.append('\tClassDB::bind_method(D_METHOD("get_type"), &MetaPlatformSDK_Message::get_type);')
+        lines.append('\tClassDB::bind_method(D_METHOD("create_pager"), &MetaPlatformSDK_Message::create_pager);')
         lines.append('\tClassDB::bind_method(D_METHOD("get_data"), &MetaPlatformSDK_Message::get_data);')
+        lines.append('\tClassDB::bind_method(D_METHOD("detach"), &MetaPlatformSDK_Message::detach);')
+        lines.append('\tClassDB::bind_method(D_METHOD("is_detached"), &MetaPlatformSDK_Message::is_detached);')
         lines.append('\tADD_PROPERTY(PropertyInfo(Variant::INT, "type"), "", "get_type");')
         lines.append('\tADD_PROPERTY(PropertyInfo(Variant::NIL, "data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_NIL_IS_VARIANT), "", "get_data");')
         lines.append('\tADD_PROPERTY(PropertyInfo(Variant::NIL, "error", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_DEFAULT | PROPERTY_USAGE_NIL_IS_VARIANT), "", "get_error");')
@@ -1276,10 +2260,15 @@ def generate_source(class_name, class_def, plan):
     if class_name == 'MetaPlatformSDK_LeaderboardEntry':
         lines.append('\tClassDB::bind_method(D_METHOD("get_extra_data"), &MetaPlatformSDK_LeaderboardEntry::get_extra_data);')
         lines.append('\tADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "extra_data"), "", "get_extra_data");')
+    if class_name in BYTE_BUFFER_CLASSES:
+        func_name = BYTE_BUFFER_CLASSES[class_name] + '_into'
+        lines.append(f'\tClassDB::bind_method(D_METHOD("{func_name}", "buffer", "offset"), &{class_name}::{func_name}, DEFVAL(0));')
     if class_def['type'] == 'result' and class_def['is_array']:
         lines.append(f'\tClassDB::bind_method(D_METHOD("_iter_init"), &{class_name}::_iter_init);')
         lines.append(f'\tClassDB::bind_method(D_METHOD("_iter_next"), &{class_name}::_iter_next);')
         lines.append(f'\tClassDB::bind_method(D_METHOD("_iter_get"), &{class_name}::_iter_get);')
+        lines.append(f'\tClassDB::bind_method(D_METHOD("to_columns"), &{class_name}::to_columns);')
+        lines.append(f'\tClassDB::bind_method(D_METHOD("to_dictionary_array"), &{class_name}::to_dictionary_array);')
     lines.append('}')
     lines.append('')
 
@@ -1328,8 +2317,31 @@ def generate_source(class_name, class_def, plan):
         lines.append('\treturn get_element(p_iter);')
         lines.append('}')
         lines.append('')
+        lines += generate_column_export(class_name, class_def, plan)
+
+        next_page_function = get_next_page_function(class_name, plan)
+        if next_page_function:
+            lines.append(f'static bool _{camel_to_snake_case(class_name)}_has_next_page(RefCounted *p_page) {{')
+            lines.append(f'\treturn static_cast<{class_name} *>(p_page)->has_next_page();')
+            lines.append('}')
+            lines.append('')
+            lines.append(f'static Ref<MetaPlatformSDK_Request> _{camel_to_snake_case(class_name)}_request_next_page(RefCounted *p_page) {{')
+            lines.append(f'\treturn MetaPlatformSDK::get_singleton()->{next_page_function}(Ref<{class_name}>(static_cast<{class_name} *>(p_page)));')
+            lines.append('}')
+            lines.append('')
+            lines.append(f'static Dictionary _{camel_to_snake_case(class_name)}_to_columns(RefCounted *p_page) {{')
+            lines.append(f'\treturn static_cast<{class_name} *>(p_page)->to_columns();')
+            lines.append('}')
+            lines.append('')
+            lines.append(f'const MetaPlatformSDK_Pager::PageFuncs {class_name}::_pager_funcs = {{')
+            lines.append(f'\t_{camel_to_snake_case(class_name)}_has_next_page,')
+            lines.append(f'\t_{camel_to_snake_case(class_name)}_request_next_page,')
+            lines.append(f'\t_{camel_to_snake_case(class_name)}_to_columns,')
+            lines.append('};')
+            lines.append('')
 
     # Generate all the OVR functions
+    snapshot_fields = get_snapshot_fields(class_name, class_def, plan) if class_def['type'] == 'result' else []
     for function_name, function in class_def['functions'].items():
         if 'exclude_source' in function and function['exclude_source']:
             continue
@@ -1338,10 +2350,32 @@ def generate_source(class_name, class_def, plan):
         null_return_value = make_null_value(function['return'], plan)
 
         lines.append(make_function_decl(function_name, function, class_name) + ' {')
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+
+        is_element_getter = class_def['type'] == 'result' and class_def['is_array'] and function_name == 'get_element'
+        is_message_payload = class_name == 'MetaPlatformSDK_Message' and ovr_function['name'] in OVR_FUNCTION_TO_MESSAGE_TYPES
+
+        if class_def['type'] == 'result' and not is_message_payload:
+            snapshot_field = next((field for field in snapshot_fields if field['getter'] == function_name), None)
+            if snapshot_field:
+                lines.append('\tif (snapshot != nullptr) {')
+                lines.append(f"\t\treturn snapshot->{snapshot_field['name']};")
+                lines.append('\t}')
+            elif is_element_getter:
+                lines.append('\tif (snapshot != nullptr) {')
+                lines.append(f'\t\tERR_FAIL_INDEX_V((int64_t)p_index, (int64_t)elements.size(), {null_return_value});')
+                lines.append('\t\treturn elements[p_index];')
+                lines.append('\t}')
+            elif function['return'] != 'void':
+                lines.append(f'\tERR_FAIL_COND_V_MSG(snapshot != nullptr, {null_return_value}, "{class_name}: {function_name}() isn\'t available after the message is detached.");')
+            else:
+                lines.append(f'\tERR_FAIL_COND_MSG(snapshot != nullptr, "{class_name}: {function_name}() isn\'t available after the message is detached.");')
 
         # Check that we are initialized.
-        if class_def['ovr_handle']:
+        if is_message_payload:
+            # Checked below, since the payload may have been kept when the message was detached.
+            pass
+        elif class_def['ovr_handle']:
             if function['return'] != 'void':
                 lines.append(f'\tERR_FAIL_NULL_V(handle, {null_return_value});')
             else:
@@ -1351,12 +2385,37 @@ def generate_source(class_name, class_def, plan):
                 lines.append(f'\tERR_FAIL_COND_V(!ovr_IsPlatformInitialized(), {null_return_value});')
             else:
                 lines.append(f'\tERR_FAIL_COND(!ovr_IsPlatformInitialized());')
+        for argument in function['arguments']:
+            argument_class_name = re.match(r'const Ref<([^>]*)>', argument['type'])
+            if argument_class_name and plan['classes'][argument_class_name[1]]['type'] == 'result':
+                # A detached result no longer has a handle to pass on.
+                detached = f"{argument['name']}.is_valid() && {argument['name']}->_get_ovr_handle() == nullptr"
+                message = f'"{class_name}: Cannot pass a result from a detached message to {function_name}()."'
+                if function['return'] != 'void':
+                    lines.append(f'\tERR_FAIL_COND_V_MSG({detached}, {null_return_value}, {message});')
+                else:
+                    lines.append(f'\tERR_FAIL_COND_MSG({detached}, {message});')
+        coalescable = class_name == 'MetaPlatformSDK' and is_coalescable(function_name, function)
+        if coalescable:
+            lines.append('')
+            lines.append('\tString coalesce_key;')
+            lines.append('\tif (request_coalescing) {')
+            lines.append('\t\tArray args;')
+            for argument in function['arguments']:
+                lines.append(f"\t\targs.push_back({argument['name']});")
+            lines.append(f'\t\tRef<MetaPlatformSDK_Request> coalesced = _join_coalesced_request("{function_name}", args, coalesce_key);')
+            lines.append('\t\tif (coalesced.is_valid()) {')
+            lines.append('\t\t\treturn coalesced;')
+            lines.append('\t\t}')
+            lines.append('\t}')
+        if is_element_getter:
+            lines.append('')
+            lines.append('\tif (p_index < elements.size() && elements[p_index].is_valid()) {')
+            lines.append('\t\treturn elements[p_index];')
+            lines.append('\t}')
         if class_name == 'MetaPlatformSDK_Message':
             if ovr_function['name'] in OVR_FUNCTION_TO_MESSAGE_TYPES:
-                valid_types = []
-                for valid_type in OVR_FUNCTION_TO_MESSAGE_TYPES[ovr_function['name']]:
-                    valid_types.append(f"type != MetaPlatformSDK::MessageType::{plan['enums']['MessageType']['value_map'][valid_type]}")
-                valid_type_expression = ' && '.join(valid_types)
+                valid_type_expression = f"_get_message_payload(type) != {get_message_payload_name(ovr_function['name'], class_def)}"
                 if function['return'] != 'void':
                     lines.append(f'\tERR_FAIL_COND_V({valid_type_expression}, {null_return_value});')
                 else:
@@ -1366,6 +2425,13 @@ def generate_source(class_name, class_def, plan):
                 lines.append('\tif (data.get_type() != Variant::NIL) {')
                 lines.append('\t\treturn data;')
                 lines.append('\t}')
+                lines.append('\tif (snapshot != nullptr) {')
+                lines.append(f'\t\treturn {null_return_value};')
+                lines.append('\t}')
+                if function['return'] != 'void':
+                    lines.append(f'\tERR_FAIL_NULL_V(handle, {null_return_value});')
+                else:
+                    lines.append(f'\tERR_FAIL_NULL(handle);')
         lines.append('')
 
         # Call to the OVR function.
@@ -1393,10 +2459,24 @@ def generate_source(class_name, class_def, plan):
             lines.append('')
 
             return_conversion = convert_return_value_from_ovr('result', ovr_function['return'], function['return'], plan)
+            if coalescable:
+                return_conversion = return_conversion[:-1] + ', coalesce_key)'
             if class_name == 'MetaPlatformSDK_Message' and ovr_function['name'] in OVR_FUNCTION_TO_MESSAGE_TYPES:
                     lines.append(f"\t{function['return']} ret = {return_conversion};")
                     lines.append('\tdata = ret;')
                     lines.append('\treturn ret;')
+            elif is_element_getter:
+                size_function = class_def['functions']['size']['ovr_function']['name']
+                lines.append(f"\t{function['return']} ret = {return_conversion};")
+                lines.append('\tif (ret.is_valid()) {')
+                lines.append('\t\tif (elements.is_empty()) {')
+                lines.append(f'\t\t\telements.resize({size_function}(handle));')
+                lines.append('\t\t}')
+                lines.append('\t\tif (p_index < elements.size()) {')
+                lines.append('\t\t\telements[p_index] = ret;')
+                lines.append('\t\t}')
+                lines.append('\t}')
+                lines.append('\treturn ret;')
             else:
                 lines.append(f'\treturn {return_conversion};')
 
@@ -1405,10 +2485,19 @@ def generate_source(class_name, class_def, plan):
             lines.append('#else')
             lines.append(f'\treturn {null_return_value};')
 
-        lines.append('#endif // ANDROID_ENABLED')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
         lines.append('}')
         lines.append('')
 
+    # Allocation counter and object pool.
+    if class_def['type'] != 'singleton':
+        lines.append(f'MetaPlatformSDKAllocationCounter {class_name}::_allocation_counter("{class_name}");')
+        if class_def['type'] == 'result':
+            # Defined after the allocation counter, which it refers to.
+            lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+            lines.append(f'MetaPlatformSDKObjectPool<{class_name}> {class_name}::_pool({class_name}::_allocation_counter);')
+            lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+        lines.append('')
     # Constructor.
     lines.append(f'{class_name}::{class_name}() {{')
     if class_def['type'] == 'singleton':
@@ -1416,26 +2505,66 @@ def generate_source(class_name, class_def, plan):
         lines.append('');
         lines.append('\tsingleton = this;')
     elif class_def['type'] == 'model':
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         lines.append(f"\thandle = {class_def['create_func']['name']}();")
-        lines.append('#endif // ANDROID_ENABLED')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+    if class_def['type'] != 'singleton':
+        lines.append('\t_allocation_counter.on_create();')
     lines.append('}')
     lines.append('')
 
     # Creation from handle.
     if class_def['type'] == 'result':
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         lines.append(f'Ref<{class_name}> {class_name}::_create_with_ovr_handle({class_def["ovr_handle"]} p_handle) {{')
         lines.append(f'\tRef<{class_name}> inst;')
         lines.append('\tif (p_handle != nullptr) {')
-        lines.append('\t\tinst.instantiate();')
+        lines.append('\t\tinst = _pool.acquire();')
         lines.append('\t\tinst->handle = p_handle;')
         if class_name == 'MetaPlatformSDK_Message':
             lines.append('\t\tinst->type = (MetaPlatformSDK::MessageType)ovr_Message_GetType(p_handle);')
         lines.append('\t}')
         lines.append('\treturn inst;')
         lines.append('}')
-        lines.append('#endif // ANDROID_ENABLED')
+        if class_name == 'MetaPlatformSDK_Message':
+            lines.append('')
+            lines.append(f'Ref<{class_name}> {class_name}::_create_with_ovr_handle({class_def["ovr_handle"]} p_handle, MetaPlatformSDK::MessageType p_type, const Variant &p_data) {{')
+            lines.append(f'\tRef<{class_name}> inst;')
+            lines.append('\tif (p_handle != nullptr) {')
+            lines.append('\t\tinst = _pool.acquire();')
+            lines.append('\t\tinst->handle = p_handle;')
+            lines.append('\t\tinst->type = p_type;')
+            lines.append('\t\tinst->data = p_data;')
+            lines.append('\t}')
+            lines.append('\treturn inst;')
+            lines.append('}')
+        lines.append('')
+
+        # Called by the object pool once nothing else refers to this object, to get it ready for reuse.
+        lines.append(f'void {class_name}::_recycle() {{')
+        if 'free_func' in class_def:
+            lines.append('\tif (handle) {')
+            lines.append(f"\t\t{class_def['free_func']['name']}(handle);")
+            lines.append('\t}')
+        lines.append('\thandle = nullptr;')
+        lines.append('\tif (snapshot != nullptr) {')
+        lines.append('\t\tmemdelete(snapshot);')
+        lines.append('\t\tsnapshot = nullptr;')
+        lines.append('\t}')
+        if class_def['is_array']:
+            lines.append('\telements.clear();')
+        if class_name == 'MetaPlatformSDK_Message':
+            lines.append('\ttype = MetaPlatformSDK::MESSAGE_UNKNOWN;')
+            lines.append('\tdata = Variant();')
+        # Scripts may have attached their own data, which mustn't carry over to the next result.
+        lines.append('\tTypedArray<StringName> meta_list = get_meta_list();')
+        lines.append('\tfor (int64_t i = 0; i < meta_list.size(); i++) {')
+        lines.append('\t\tremove_meta(meta_list[i]);')
+        lines.append('\t}')
+        lines.append('}')
+        lines.append('')
+        lines += generate_snapshot(class_name, class_def, plan)
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
         lines.append('')
 
     # Destructor.
@@ -1443,15 +2572,21 @@ def generate_source(class_name, class_def, plan):
     if class_def['type'] == 'singleton':
         lines.append('\tsingleton = nullptr;')
     elif class_def['type'] == 'model':
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         lines.append(f"\t{class_def['destroy_func']['name']}(handle);")
-        lines.append('#endif // ANDROID_ENABLED')
-    elif class_def['type'] == 'result' and 'free_func' in class_def:
-        lines.append('#ifdef ANDROID_ENABLED')
-        lines.append('\tif (handle) {')
-        lines.append(f"\t\t{class_def['free_func']['name']}(handle);")
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+    elif class_def['type'] == 'result':
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+        if 'free_func' in class_def:
+            lines.append('\tif (handle) {')
+            lines.append(f"\t\t{class_def['free_func']['name']}(handle);")
+            lines.append('\t}')
+        lines.append('\tif (snapshot != nullptr) {')
+        lines.append('\t\tmemdelete(snapshot);')
         lines.append('\t}')
-        lines.append('#endif // ANDROID_ENABLED')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+    if class_def['type'] != 'singleton':
+        lines.append('\t_allocation_counter.on_free();')
     lines.append('}')
     lines.append('')
 
@@ -1466,13 +2601,75 @@ def generate_source(class_name, class_def, plan):
 
         lines.append('}')
         lines.append('')
+
+        # Notification handlers are kept in a dense table, with a slot for each notification type.
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+        lines.append('int32_t MetaPlatformSDK::_get_notification_index(ovrMessageType p_type) {')
+        lines.append('\tswitch (p_type) {')
+        for index, ovr_type in enumerate(plan['notification_types']):
+            lines.append(f'\t\tcase {ovr_type}:')
+            lines.append(f'\t\t\treturn {index};')
+        lines.append('\t\tdefault:')
+        lines.append('\t\t\treturn -1;')
+        lines.append('\t}')
+        lines.append('}')
+        lines.append('')
+        lines.append('bool MetaPlatformSDK::_is_notification_filterable(ovrMessageType p_type) {')
+        lines.append('\tswitch (p_type) {')
+        for ovr_type in plan['notification_filters']:
+            lines.append(f'\t\tcase {ovr_type}:')
+        if len(plan['notification_filters']) > 0:
+            lines.append('\t\t\treturn true;')
+        lines.append('\t\tdefault:')
+        lines.append('\t\t\treturn false;')
+        lines.append('\t}')
+        lines.append('}')
+        lines.append('')
+        lines.append('bool MetaPlatformSDK::_get_notification_filter_id(ovrMessageHandle p_message, ovrMessageType p_type, uint64_t &r_filter_id) {')
+        lines.append('\tif (ovr_Message_IsError(p_message)) {')
+        lines.append('\t\treturn false;')
+        lines.append('\t}')
+        lines.append('')
+        lines.append('\tswitch (p_type) {')
+        for ovr_type, (payload_function, id_function) in plan['notification_filters'].items():
+            lines.append(f'\t\tcase {ovr_type}:')
+            lines.append(f'\t\t\tr_filter_id = (uint64_t){id_function}({payload_function}(p_message));')
+            lines.append('\t\t\treturn true;')
+        lines.append('\t\tdefault:')
+        lines.append('\t\t\treturn false;')
+        lines.append('\t}')
+        lines.append('}')
+        lines.append('')
+        lines.append('bool MetaPlatformSDK::_get_notification_coalesce_key(ovrMessageHandle p_message, ovrMessageType p_type, uint64_t &r_key) {')
+        lines.append('\tif (ovr_Message_IsError(p_message)) {')
+        lines.append('\t\treturn false;')
+        lines.append('\t}')
+        lines.append('')
+        lines.append('\tswitch (p_type) {')
+        for ovr_type, (payload_function, key_function, final_function) in plan['notification_coalesce_keys'].items():
+            lines.append(f'\t\tcase {ovr_type}:')
+            if final_function is not None:
+                lines.append(f'\t\t\tif ({final_function}({payload_function}(p_message))) {{')
+                lines.append('\t\t\t\treturn false;')
+                lines.append('\t\t\t}')
+            if key_function is not None:
+                lines.append(f'\t\t\tr_key = (uint64_t){key_function}({payload_function}(p_message));')
+            else:
+                lines.append('\t\t\tr_key = 0;')
+            lines.append('\t\t\treturn true;')
+        lines.append('\t\tdefault:')
+        lines.append('\t\t\treturn false;')
+        lines.append('\t}')
+        lines.append('}')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+        lines.append('')
     elif class_name == 'MetaPlatformSDK_Message':
         #
         # MetaPlatformSDK_Message::get_data()
         #
 
         lines.append('Variant MetaPlatformSDK_Message::get_data() const {')
-        lines.append('#ifdef ANDROID_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
         lines.append('\tERR_FAIL_COND_V(type == MetaPlatformSDK::MessageType::MESSAGE_UNKNOWN, Variant());')
         lines.append('')
         lines.append('\tif (data.get_type() != Variant::NIL) {')
@@ -1480,31 +2677,34 @@ def generate_source(class_name, class_def, plan):
         lines.append('\t}')
         lines.append('')
 
-        lines.append('\tswitch (type) {')
-        for ovr_function, ovr_types in OVR_FUNCTION_TO_MESSAGE_TYPES.items():
-            for ovr_type in ovr_types:
-                type_name = plan['enums']['MessageType']['value_map'][ovr_type]
-                lines.append(f'\t\tcase MetaPlatformSDK::MessageType::{type_name}:')
-
-            if ovr_function== '!ovr_Message_IsError':
-                lines.append(f'\t\t\tdata = is_success();')
-            else:
-                function_name = class_def['function_map'][ovr_function]
-                lines.append(f'\t\t\t{function_name}();')
-
-            lines.append(f'\t\t\tbreak;')
-            lines.append('')
-
-        lines.append('\t\tcase MetaPlatformSDK::MessageType::MESSAGE_UNKNOWN:')
-        lines.append('\t\tdefault:')
-        lines.append('\t\t\tERR_PRINT(vformat("MetaPlatformSDK_Message: Cannot get data for unknown message type %s", type));')
+        lines.append('\tMessagePayload payload = _get_message_payload(type);')
+        lines.append('\tif (payload == MESSAGE_PAYLOAD_NONE) {')
+        lines.append('\t\tERR_PRINT(vformat("MetaPlatformSDK_Message: Cannot get data for unknown message type %s", type));')
+        lines.append('\t\treturn data;')
         lines.append('\t}')
         lines.append('')
+        lines.append('\tdata = MESSAGE_PAYLOAD_DECODERS[payload](this);')
         lines.append('\treturn data;')
         lines.append('#else')
         lines.append('\treturn Variant();')
-        lines.append('#endif // ANDROID_ENABLED')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+        lines.append('}')
+        lines.append('')
+
+        # Decodes the payload ahead of get_data(), so it can be done off the main thread. Unlike get_data(), this
+        # quietly skips messages without a payload.
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+        lines.append('void MetaPlatformSDK_Message::_predecode_data() {')
+        lines.append('\tif (handle == nullptr || data.get_type() != Variant::NIL || ovr_Message_IsError(handle)) {')
+        lines.append('\t\treturn;')
+        lines.append('\t}')
+        lines.append('')
+        lines.append('\tMessagePayload payload = _get_message_payload(type);')
+        lines.append('\tif (payload != MESSAGE_PAYLOAD_NONE) {')
+        lines.append('\t\tdata = MESSAGE_PAYLOAD_DECODERS[payload](this);')
+        lines.append('\t}')
         lines.append('}')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
         lines.append('')
 
         #
@@ -1512,6 +2712,17 @@ def generate_source(class_name, class_def, plan):
         #
 
         lines.append('String MetaPlatformSDK_Message::get_type_as_string() const {')
+        lines.append('\tint32_t index = _get_message_type_index(type);')
+        lines.append('\treturn index >= 0 ? MESSAGE_TYPE_NAMES[index] : "MESSAGE_UNKNOWN";')
+        lines.append('}')
+        lines.append('')
+
+        # The switches the tables replaced, to compare them against.
+        lines.append('#ifdef META_TOOLKIT_BENCHMARKS_ENABLED')
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+        lines += generate_message_get_data_switch('_get_data_with_switch', class_def, plan)
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
+        lines.append('String MetaPlatformSDK_Message::_get_type_as_string_with_switch() const {')
         lines.append('\tswitch (type) {')
         for value in plan['enums']['MessageType']['values']:
             lines.append(f'\t\tcase MetaPlatformSDK::MessageType::{value["name"]}:')
@@ -1519,11 +2730,238 @@ def generate_source(class_name, class_def, plan):
         lines.append('\t}')
         lines.append('\treturn "MESSAGE_UNKNOWN";')
         lines.append('}')
+        lines.append('#endif // META_TOOLKIT_BENCHMARKS_ENABLED')
+        lines.append('')
+
+        #
+        # MetaPlatformSDK_Message::create_pager()
+        #
+
+        lines.append('Ref<MetaPlatformSDK_Pager> MetaPlatformSDK_Message::create_pager() {')
+        lines.append('\tswitch (type) {')
+        for ovr_function, ovr_types in OVR_FUNCTION_TO_MESSAGE_TYPES.items():
+            if ovr_function not in class_def['function_map']:
+                continue
+            page_class_name = re.match(r'Ref<([^>]*)>', class_def['functions'][class_def['function_map'][ovr_function]]['return'])
+            if not page_class_name or not get_next_page_function(page_class_name[1], plan):
+                continue
+            for ovr_type in ovr_types:
+                type_name = plan['enums']['MessageType']['value_map'][ovr_type]
+                lines.append(f'\t\tcase MetaPlatformSDK::MessageType::{type_name}:')
+            lines.append(f'\t\t\treturn MetaPlatformSDK_Pager::_create(Ref<MetaPlatformSDK_Message>(this), &{page_class_name[1]}::_pager_funcs);')
+        lines.append('\t\tdefault:')
+        lines.append('\t\t\tbreak;')
+        lines.append('\t}')
+        lines.append('\tERR_FAIL_V_MSG(Ref<MetaPlatformSDK_Pager>(), vformat("MetaPlatformSDK_Message: Message type %s isn\'t paginated", get_type_as_string()));')
+        lines.append('}')
+        lines.append('')
+
+        # Detaching frees the native array, which is needed to request the next page.
+        lines.append('#ifdef META_PLATFORM_SDK_ENABLED')
+        lines.append('bool MetaPlatformSDK_Message::_has_next_page() const {')
+        lines.append('\tif (type == MetaPlatformSDK::MessageType::MESSAGE_UNKNOWN || is_error()) {')
+        lines.append('\t\treturn false;')
+        lines.append('\t}')
+        lines.append('')
+        lines.append('\tswitch (type) {')
+        for ovr_function, ovr_types in OVR_FUNCTION_TO_MESSAGE_TYPES.items():
+            if ovr_function not in class_def['function_map']:
+                continue
+            page_class_name = re.match(r'Ref<([^>]*)>', class_def['functions'][class_def['function_map'][ovr_function]]['return'])
+            if not page_class_name or not get_next_page_function(page_class_name[1], plan):
+                continue
+            for ovr_type in ovr_types:
+                type_name = plan['enums']['MessageType']['value_map'][ovr_type]
+                lines.append(f'\t\tcase MetaPlatformSDK::MessageType::{type_name}:')
+            lines.append('\t\t{')
+            lines.append(f'\t\t\tRef<{page_class_name[1]}> page = get_data();')
+            lines.append('\t\t\treturn page.is_valid() && page->has_next_page();')
+            lines.append('\t\t}')
+        lines.append('\t\tdefault:')
+        lines.append('\t\t\treturn false;')
+        lines.append('\t}')
+        lines.append('}')
+        lines.append('#endif // META_PLATFORM_SDK_ENABLED')
         lines.append('')
 
     return lines
 
 
+def get_stub_field_name(function_name, prefix):
+    field = function_name[len(prefix):] if function_name.startswith(prefix) else function_name[4:]
+    if re.match(r'Get[A-Z]', field):
+        field = field[3:]
+    return field
+
+
+def generate_stub_source(headers):
+    """Generates stand-ins for every OVR function, backed by MetaPlatformSDK_Stub."""
+    lines = []
+
+    lines.append('// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.')
+    lines.append('')
+    lines.append('// THIS FILE IS GENERATED. EDITS WILL BE LOST.')
+    lines.append('')
+    lines.append('#ifdef META_PLATFORM_SDK_STUB')
+    lines.append('#include <OVR_Platform.h>')
+    for header_name in sorted(headers.keys()):
+        lines.append(f'#include <{header_name}>')
+    lines.append('')
+    lines.append('#include <cstring>')
+    lines.append('')
+    lines.append('#include "platform_sdk_stub/meta_platform_sdk_stub.h"')
+    lines.append('')
+    lines.append('static _FORCE_INLINE_ MetaPlatformSDKStubMessage *_message(const void *p_handle) {')
+    lines.append('	return (MetaPlatformSDKStubMessage *)p_handle;')
+    lines.append('}')
+    lines.append('')
+    lines.append('static _FORCE_INLINE_ MetaPlatformSDKStubObject *_object(const void *p_handle) {')
+    lines.append('	return MetaPlatformSDKStubObject::from_handle(p_handle);')
+    lines.append('}')
+    lines.append('')
+    lines.append('extern "C" {')
+    lines.append('')
+
+    all_handles = []
+    all_enums = {}
+    all_message_types = []
+    for header in headers.values():
+        all_handles += header.get('handles', [])
+        for enum_name, enum in header.get('enums', {}).items():
+            all_enums[enum_name] = enum
+            if enum_name == 'ovrMessageType':
+                all_message_types = [v['name'] for v in enum['values']]
+
+    def make_getter(return_type, object_expr, field):
+        plain_type = return_type[6:] if return_type.startswith('const ') and not return_type.endswith('*') else return_type
+        if plain_type == 'void':
+            return None
+        elif plain_type == 'bool':
+            return f'return (bool){object_expr}->get_field("{field}");'
+        elif plain_type == 'const char*':
+            return f'return {object_expr}->get_string("{field}");'
+        elif plain_type == 'const void*':
+            return f'return {object_expr}->get_bytes("{field}");'
+        elif plain_type in all_handles:
+            return f'return ({plain_type}){object_expr}->get_child("{field}");'
+        elif plain_type in ['float', 'double']:
+            return f'return ({plain_type})(double){object_expr}->get_field("{field}");'
+        elif plain_type in STUB_NUMBER_TYPES or plain_type in all_enums:
+            return f'return ({plain_type})(int64_t){object_expr}->get_field("{field}");'
+        return 'return {};'
+
+    defined = set()
+    for header_name in sorted(headers.keys()):
+        header = headers[header_name]
+        handles = header.get('handles', [])
+
+        for function_name, ovr_function in header.get('functions', {}).items():
+            if function_name in defined:
+                continue
+            arguments = [a for a in ovr_function['arguments'] if a['type'] != 'void']
+            # These are only declared on the platforms they're for.
+            if any(re.search(r'\b(jobject|JNIEnv|JavaVM)\b', a['type']) for a in arguments):
+                continue
+            defined.add(function_name)
+
+            argument_names = [a.get('name', f'arg{i}') for i, a in enumerate(arguments)]
+            argument_list = ', '.join(f"{a['type']} {argument_names[i]}" for i, a in enumerate(arguments))
+            return_type = ovr_function['return']
+            self_handle = None
+            if len(arguments) > 0:
+                first_type = arguments[0]['type']
+                if first_type.startswith('const '):
+                    first_type = first_type[6:]
+                if first_type in handles:
+                    self_handle = first_type
+
+            body = []
+            enum_match = re.match(r'(.*)_(ToString|FromString)$', function_name)
+            if function_name in STUB_FUNCTION_BODIES:
+                body.append(STUB_FUNCTION_BODIES[function_name].format(*argument_names))
+
+            elif enum_match and enum_match[1] in all_enums:
+                values = [v['name'] for v in all_enums[enum_match[1]]['values']]
+                if enum_match[2] == 'ToString':
+                    for value in values:
+                        body.append(f'if ({argument_names[0]} == {value}) {{')
+                        body.append(f'\treturn "{value}";')
+                        body.append('}')
+                    body.append('return "";')
+                else:
+                    for value in values:
+                        body.append(f'if (strcmp({argument_names[0]}, "{value}") == 0) {{')
+                        body.append(f'\treturn {value};')
+                        body.append('}')
+                    body.append(f'return ({enum_match[1]})0;')
+
+            elif function_name == 'ovrMessageType_IsNotification':
+                body.append(f'switch ({argument_names[0]}) {{')
+                for value in all_message_types:
+                    if value.startswith('ovrMessage_Notification_'):
+                        body.append(f'\tcase {value}:')
+                body.append('\t\treturn true;')
+                body.append('\tdefault:')
+                body.append('\t\treturn false;')
+                body.append('}')
+
+            elif return_type == 'ovrRequest':
+                message_type = 'ovrMessage_' + function_name[4:]
+                if message_type in all_message_types:
+                    body.append(f'return MetaPlatformSDK_Stub::get_singleton()->_request({message_type});')
+                else:
+                    body.append('return 0;')
+
+            elif self_handle is not None:
+                base_name = self_handle[3:] if self_handle.startswith('ovr') else self_handle
+                if base_name.endswith('Handle'):
+                    base_name = base_name[:-6]
+                prefix = f'ovr_{base_name}_'
+                self_name = argument_names[0]
+                is_array = f'{prefix}GetSize' in header['functions'] and f'{prefix}GetElement' in header['functions']
+
+                if function_name == f'{prefix}Destroy':
+                    body.append(f'if ({self_name} != nullptr) {{')
+                    body.append(f'\tmemdelete((MetaPlatformSDKStubObject *){self_name});')
+                    body.append('}')
+                elif is_array and function_name == f'{prefix}GetSize':
+                    body.append(f'return ({return_type})_object({self_name})->get_size();')
+                elif is_array and function_name == f'{prefix}GetElement':
+                    body.append(f'return ({return_type})_object({self_name})->get_element({argument_names[1]});')
+                elif self_handle == 'ovrMessageHandle' and return_type in all_handles:
+                    # Every message payload getter returns the scripted data.
+                    body.append(f'return ({return_type})&_message({self_name})->payload;')
+                elif self_handle == 'ovrMessageHandle':
+                    getter = make_getter(return_type, f'(&_message({self_name})->payload)', get_stub_field_name(function_name, prefix))
+                    if getter:
+                        body.append(getter)
+                else:
+                    # Setters on model objects are accepted, but nothing reads them back.
+                    getter = make_getter(return_type, f'_object({self_name})', get_stub_field_name(function_name, prefix))
+                    if getter:
+                        body.append(getter)
+
+            elif function_name.endswith('_Create') and return_type in all_handles:
+                body.append(f'return ({return_type})memnew(MetaPlatformSDKStubObject);')
+
+            else:
+                getter = make_getter(return_type, 'MetaPlatformSDK_Stub::get_singleton()->_get_globals()', get_stub_field_name(function_name, 'ovr_'))
+                if getter:
+                    body.append(getter)
+
+            lines.append(f'{return_type} {function_name}({argument_list}) {{')
+            for line in body:
+                lines.append('\t' + line)
+            lines.append('}')
+            lines.append('')
+
+    lines.append('} // extern "C"')
+    lines.append('#endif // META_PLATFORM_SDK_STUB')
+    lines.append('')
+
+    return lines
+
+
 def get_xml_text(node_list):
     rc = []
     for node in node_list:
@@ -1727,6 +3165,9 @@ def scons_emit_files(target, source, env):
         raise Exception("SDK headers path '%s' doesn't contain 'OVR_Platform.h'" % sdk_headers_path)
 
     headers = parse_headers(sdk_headers_path)
+    modules = parse_platform_sdk_modules(env.get('platform_sdk_modules', ''))
+    if len(modules) > 0:
+        headers = select_platform_sdk_modules(headers, modules)
     plan = make_codegen_plan(headers)
     output_path = target[0].abspath
 
@@ -1738,6 +3179,7 @@ def scons_emit_files(target, source, env):
         file_base = camel_to_snake_case(class_name)
         files.append(env.File(os.path.join(header_path, file_base + '.h')))
         files.append(env.File(os.path.join(source_path, file_base + '.cpp')))
+    files.append(env.File(os.path.join(source_path, 'ovr_platform_stub.cpp')))
 
     env.Clean(target, files)
     env["godot_meta_toolkit_gen_dir"] = output_path
@@ -1746,9 +3188,14 @@ def scons_emit_files(target, source, env):
 
 def scons_generate_bindings(target, source, env):
     headers = parse_headers(str(source[0]))
-    plan = make_codegen_plan(headers)
-
-    generate_code(plan, env["godot_meta_toolkit_gen_dir"])
+    selected_headers = headers
+    modules = parse_platform_sdk_modules(env.get('platform_sdk_modules', ''))
+    if len(modules) > 0:
+        selected_headers = select_platform_sdk_modules(headers, modules)
+    plan = make_codegen_plan(selected_headers)
+
+    # The stub always stands in for the whole Platform SDK, which the hand-written code may call directly.
+    generate_code(plan, headers, env["godot_meta_toolkit_gen_dir"])
     return None
 
 
@@ -1765,6 +3212,7 @@ def main():
     parser.add_argument('--dump-codegen-plan', type=str, metavar='PATH', help="Path to dump the codegen plan in JSON format")
     parser.add_argument('--update-docs-xml', type=str, metavar='PATH', help='Path to XML documentation to update with generated descriptions')
     parser.add_argument('--overwrite-docs', action='store_true', help='Overwrite existing documentation with autogenerated text')
+    parser.add_argument('--modules', type=str, default='', help="Comma-separated list of Platform SDK API families to bind, for example: IAP,Achievements (default: all of them)")
     parser.add_argument('--verbose', action='store_true', default=False, help="Show extra messages and simple stats")
 
     args = parser.parse_args()
@@ -1777,6 +3225,8 @@ def main():
     if args.update_docs_xml:
         if not os.path.exists(args.update_docs_xml) or not os.path.isdir(args.update_docs_xml):
             raise Exception("Non-existent directory '%s' given for --update-docs-xml" % args.update_docs_xml)
+        if args.modules:
+            raise Exception("The XML documentation can only be updated when binding all the Platform SDK modules")
     if not os.path.exists(args.output_path):
         os.makedirs(args.output_path)
     elif not os.path.isdir(args.output_path):
@@ -1789,7 +3239,11 @@ def main():
             json.dump(headers, fd, indent=4)
 
     # Transform that into a plan for the code we'll generate.
-    plan = make_codegen_plan(headers, args.verbose)
+    selected_headers = headers
+    modules = parse_platform_sdk_modules(args.modules)
+    if len(modules) > 0:
+        selected_headers = select_platform_sdk_modules(headers, modules)
+    plan = make_codegen_plan(selected_headers, args.verbose)
     if args.dump_codegen_plan:
         with open(args.dump_codegen_plan, 'wt') as fd:
             json.dump(plan, fd, indent=4)
@@ -1799,7 +3253,7 @@ def main():
         print("Enums:", len(plan['enums']))
 
     # Generate the code.
-    generate_code(plan, args.output_path)
+    generate_code(plan, headers, args.output_path)
 
     # Optionally, update XML docs.
     if args.update_docs_xml:
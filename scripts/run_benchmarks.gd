@@ -0,0 +1,36 @@
+# Runs the native micro-benchmarks and prints the results as JSON.
+#
+# The extension needs to be built with 'scons benchmarks=yes' (add 'platform_sdk_stub=yes' on desktop to
+# include the benchmarks that go through the Platform SDK), then run from the root directory with:
+#
+#   godot --headless --path demo --script "$PWD/scripts/run_benchmarks.gd"
+#
+# To also write the results to a file, for comparing between builds:
+#
+#   godot --headless --path demo --script "$PWD/scripts/run_benchmarks.gd" -- --output=results.json
+#
+extends SceneTree
+
+func _init() -> void:
+	if not ClassDB.class_exists("MetaToolkitBenchmarks"):
+		printerr("MetaToolkitBenchmarks isn't available; build the extension with 'scons benchmarks=yes'")
+		quit(1)
+		return
+
+	var output_path := ""
+	for arg in OS.get_cmdline_user_args():
+		if arg.begins_with("--output="):
+			output_path = arg.trim_prefix("--output=")
+
+	var benchmarks = ClassDB.instantiate("MetaToolkitBenchmarks")
+	var results := JSON.stringify(benchmarks.run_all(), "\t")
+	print(results)
+
+	if not output_path.is_empty():
+		var file := FileAccess.open(output_path, FileAccess.WRITE)
+		if file == null:
+			printerr("Unable to write results to '%s': %s" % [output_path, error_string(FileAccess.get_open_error())])
+			quit(1)
+			return
+		file.store_string(results)
+	quit()
@@ -0,0 +1,450 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "benchmark/meta_toolkit_benchmarks.h"
+
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+#include "platform_sdk/meta_platform_sdk_byte_buffer.h"
+#include "platform_sdk/meta_platform_sdk_request_table.h"
+#include "util.h"
+
+#ifdef META_PLATFORM_SDK_STUB
+#include "platform_sdk/meta_platform_sdk.h"
+#include "platform_sdk/meta_platform_sdk_http_transfer_update.h"
+#include "platform_sdk/meta_platform_sdk_leaderboard_entry.h"
+#include "platform_sdk/meta_platform_sdk_leaderboard_entry_array.h"
+#include "platform_sdk/meta_platform_sdk_message.h"
+#include "platform_sdk_stub/meta_platform_sdk_stub.h"
+#endif // META_PLATFORM_SDK_STUB
+
+// Aim to copy this many bytes in total for each case, so small and large payloads take comparable time.
+static const uint64_t BYTE_COPY_TOTAL_BYTES = 256 * 1024 * 1024;
+// Aim for this many inserts (and erases) for each number of requests in flight.
+static const uint64_t REQUEST_TABLE_TOTAL_OPS = 1000000;
+// Visits the requests out of order. It's prime, so it doesn't share a factor with any of the table sizes.
+static const uint64_t REQUEST_TABLE_STRIDE = 7919;
+
+#ifdef META_PLATFORM_SDK_STUB
+// Aim to dispatch this many messages for each number of messages per frame.
+static const uint64_t MESSAGE_PUMP_TOTAL_MESSAGES = 200000;
+static const uint64_t MESSAGE_CREATE_ITERATIONS = 200000;
+static const uint64_t MESSAGE_DISPATCH_ITERATIONS = 1000000;
+static const int64_t ARRAY_ITERATION_SIZE = 1000;
+static const uint64_t ARRAY_ITERATION_PASSES = 200;
+#endif // META_PLATFORM_SDK_STUB
+
+// Keeps the compiler from optimizing away work whose result is otherwise unused.
+static volatile uint64_t benchmark_sink = 0;
+
+static Dictionary make_result(uint64_t p_iterations, uint64_t p_elapsed_usec) {
+	Dictionary result;
+	result["iterations"] = p_iterations;
+	result["total_usec"] = p_elapsed_usec;
+	result["nsec_per_op"] = (double)p_elapsed_usec * 1000.0 / (double)p_iterations;
+	return result;
+}
+
+static Dictionary make_frame_result(uint64_t p_frames, uint64_t p_messages_per_frame, uint64_t p_elapsed_usec) {
+	Dictionary result = make_result(p_frames * p_messages_per_frame, p_elapsed_usec);
+	result["frames"] = p_frames;
+	result["usec_per_frame"] = (double)p_elapsed_usec / (double)p_frames;
+	return result;
+}
+
+void MetaToolkitBenchmarks::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("run_byte_copy"), &MetaToolkitBenchmarks::run_byte_copy);
+	ClassDB::bind_method(D_METHOD("run_request_table"), &MetaToolkitBenchmarks::run_request_table);
+#ifdef META_PLATFORM_SDK_STUB
+	ClassDB::bind_method(D_METHOD("run_message_pump"), &MetaToolkitBenchmarks::run_message_pump);
+	ClassDB::bind_method(D_METHOD("run_message_create"), &MetaToolkitBenchmarks::run_message_create);
+	ClassDB::bind_method(D_METHOD("run_message_dispatch"), &MetaToolkitBenchmarks::run_message_dispatch);
+	ClassDB::bind_method(D_METHOD("run_array_iteration"), &MetaToolkitBenchmarks::run_array_iteration);
+	ClassDB::bind_method(D_METHOD("run_get_bytes"), &MetaToolkitBenchmarks::run_get_bytes);
+#endif // META_PLATFORM_SDK_STUB
+	ClassDB::bind_method(D_METHOD("run_all"), &MetaToolkitBenchmarks::run_all);
+}
+
+Dictionary MetaToolkitBenchmarks::run_byte_copy() {
+	Time *time = Time::get_singleton();
+	Dictionary results;
+
+	const uint64_t sizes[] = { 1024, 64 * 1024, 4 * 1024 * 1024 };
+	for (uint64_t size : sizes) {
+		PackedByteArray source;
+		source.resize(size);
+		source.fill(0xAB);
+		const uint8_t *source_ptr = source.ptr();
+
+		uint64_t iterations = MAX(BYTE_COPY_TOTAL_BYTES / size, (uint64_t)16);
+
+		// What get_bytes() and get_extra_data() do: a new PackedByteArray for every call.
+		uint64_t start = time->get_ticks_usec();
+		for (uint64_t i = 0; i < iterations; i++) {
+			PackedByteArray bytes = bytes_to_packed_byte_array(source_ptr, size);
+			benchmark_sink = benchmark_sink + bytes[size - 1];
+		}
+		Dictionary allocating = make_result(iterations, time->get_ticks_usec() - start);
+
+		// What get_bytes_into() and get_extra_data_into() do: copy into a buffer that's reused.
+		Ref<MetaPlatformSDK_ByteBuffer> buffer = MetaPlatformSDK_ByteBuffer::acquire(size);
+		start = time->get_ticks_usec();
+		for (uint64_t i = 0; i < iterations; i++) {
+			benchmark_sink = benchmark_sink + buffer->_write(source_ptr, size, 0);
+		}
+		Dictionary reuse = make_result(iterations, time->get_ticks_usec() - start);
+		buffer->release();
+
+		Dictionary result;
+		result["allocating"] = allocating;
+		result["reuse"] = reuse;
+		results[itos(size)] = result;
+	}
+
+	return results;
+}
+
+Dictionary MetaToolkitBenchmarks::run_request_table() {
+	Time *time = Time::get_singleton();
+	Dictionary results;
+
+	// The table only holds on to the reference, so they can all share one.
+	Ref<MetaPlatformSDK_Request> request;
+	request.instantiate();
+
+	const uint64_t in_flight_counts[] = { 100, 10000, 100000 };
+	for (uint64_t in_flight : in_flight_counts) {
+		uint64_t rounds = MAX(REQUEST_TABLE_TOTAL_OPS / in_flight, (uint64_t)1);
+		uint64_t insert_usec = 0;
+		uint64_t in_order_usec = 0;
+		uint64_t out_of_order_usec = 0;
+		uint64_t next_id = 1;
+
+		for (uint64_t round = 0; round < rounds; round++) {
+			// Responses arriving in the same order as the requests were made.
+			MetaPlatformSDKRequestTable table;
+			uint64_t start = time->get_ticks_usec();
+			for (uint64_t i = 0; i < in_flight; i++) {
+				table.insert(next_id + i, request, 0, 0);
+			}
+			insert_usec += time->get_ticks_usec() - start;
+
+			start = time->get_ticks_usec();
+			for (uint64_t i = 0; i < in_flight; i++) {
+				benchmark_sink = benchmark_sink + (table.find(next_id + i) != nullptr);
+				table.erase(next_id + i);
+			}
+			in_order_usec += time->get_ticks_usec() - start;
+
+			// Responses arriving in an order unrelated to the requests.
+			for (uint64_t i = 0; i < in_flight; i++) {
+				table.insert(next_id + in_flight + i, request, 0, 0);
+			}
+			start = time->get_ticks_usec();
+			for (uint64_t i = 0; i < in_flight; i++) {
+				uint64_t id = next_id + in_flight + (i * REQUEST_TABLE_STRIDE) % in_flight;
+				benchmark_sink = benchmark_sink + (table.find(id) != nullptr);
+				table.erase(id);
+			}
+			out_of_order_usec += time->get_ticks_usec() - start;
+
+			next_id += in_flight * 2;
+		}
+
+		Dictionary result;
+		result["insert"] = make_result(rounds * in_flight, insert_usec);
+		result["find_erase_in_order"] = make_result(rounds * in_flight, in_order_usec);
+		result["find_erase_out_of_order"] = make_result(rounds * in_flight, out_of_order_usec);
+		results[itos(in_flight)] = result;
+	}
+
+	return results;
+}
+
+#ifdef META_PLATFORM_SDK_STUB
+Dictionary MetaToolkitBenchmarks::run_message_pump() {
+	Time *time = Time::get_singleton();
+	MetaPlatformSDK *sdk = MetaPlatformSDK::get_singleton();
+	MetaPlatformSDK_Stub *stub = MetaPlatformSDK_Stub::get_singleton();
+	Dictionary results;
+
+	// Pump everything by hand, without any limits, and put the settings back afterwards.
+	bool automatic = sdk->is_message_pump_automatic();
+	bool threaded = sdk->is_message_pump_threaded();
+	int64_t time_budget_usec = sdk->get_message_pump_time_budget_usec();
+	int32_t max_messages = sdk->get_message_pump_max_messages();
+	sdk->set_message_pump_automatic(false);
+	sdk->set_message_pump_threaded(false);
+	sdk->set_message_pump_time_budget_usec(0);
+	sdk->set_message_pump_max_messages(0);
+	sdk->initialize_platform("benchmark", Dictionary());
+
+	stub->reset();
+	Dictionary user;
+	user["ID"] = 1;
+	user["DisplayName"] = "Benchmark";
+	Dictionary response;
+	response["data"] = user;
+	stub->set_response(ovrMessage_User_Get, response);
+
+	Dictionary download_update;
+	download_update["AssetId"] = 1;
+	download_update["BytesTransferred"] = 1024;
+	download_update["BytesTotal"] = 4096;
+
+	const uint64_t per_frame_counts[] = { 10, 100, 1000 };
+	for (uint64_t per_frame : per_frame_counts) {
+		uint64_t frames = MAX(MESSAGE_PUMP_TOTAL_MESSAGES / per_frame, (uint64_t)16);
+
+		uint64_t notifications_usec = 0;
+		for (uint64_t frame = 0; frame < frames; frame++) {
+			stub->push_notification(ovrMessage_Notification_AssetFile_DownloadUpdate, download_update, per_frame);
+			uint64_t start = time->get_ticks_usec();
+			benchmark_sink = benchmark_sink + sdk->pump_messages();
+			notifications_usec += time->get_ticks_usec() - start;
+		}
+
+		// Responses also go through the request table.
+		uint64_t responses_usec = 0;
+		for (uint64_t frame = 0; frame < frames; frame++) {
+			for (uint64_t i = 0; i < per_frame; i++) {
+				sdk->user_get_async(1);
+			}
+			uint64_t start = time->get_ticks_usec();
+			benchmark_sink = benchmark_sink + sdk->pump_messages();
+			responses_usec += time->get_ticks_usec() - start;
+		}
+
+		Dictionary result;
+		result["notifications"] = make_frame_result(frames, per_frame, notifications_usec);
+		result["responses"] = make_frame_result(frames, per_frame, responses_usec);
+		results[itos(per_frame)] = result;
+	}
+
+	stub->reset();
+	sdk->set_message_pump_max_messages(max_messages);
+	sdk->set_message_pump_time_budget_usec(time_budget_usec);
+	sdk->set_message_pump_threaded(threaded);
+	sdk->set_message_pump_automatic(automatic);
+
+	return results;
+}
+
+Dictionary MetaToolkitBenchmarks::run_message_create() {
+	Time *time = Time::get_singleton();
+	MetaPlatformSDK_Stub *stub = MetaPlatformSDK_Stub::get_singleton();
+	Dictionary results;
+
+	stub->reset();
+	Dictionary user;
+	user["ID"] = 1;
+	user["DisplayName"] = "Benchmark";
+	Dictionary response;
+	response["data"] = user;
+	stub->set_response(ovrMessage_User_Get, response);
+
+	// What the stub itself costs, to subtract from the others.
+	uint64_t start = time->get_ticks_usec();
+	for (uint64_t i = 0; i < MESSAGE_CREATE_ITERATIONS; i++) {
+		stub->_request(ovrMessage_User_Get);
+		ovr_FreeMessage(ovr_PopMessage());
+	}
+	results["stub_baseline"] = make_result(MESSAGE_CREATE_ITERATIONS, time->get_ticks_usec() - start);
+
+	start = time->get_ticks_usec();
+	for (uint64_t i = 0; i < MESSAGE_CREATE_ITERATIONS; i++) {
+		stub->_request(ovrMessage_User_Get);
+		Ref<MetaPlatformSDK_Message> message = MetaPlatformSDK_Message::_create_with_ovr_handle(ovr_PopMessage());
+		benchmark_sink = benchmark_sink + message->get_type();
+	}
+	results["create_with_ovr_handle"] = make_result(MESSAGE_CREATE_ITERATIONS, time->get_ticks_usec() - start);
+
+	start = time->get_ticks_usec();
+	for (uint64_t i = 0; i < MESSAGE_CREATE_ITERATIONS; i++) {
+		stub->_request(ovrMessage_User_Get);
+		Ref<MetaPlatformSDK_Message> message = MetaPlatformSDK_Message::_create_with_ovr_handle(ovr_PopMessage());
+		benchmark_sink = benchmark_sink + message->get_data().get_type();
+	}
+	results["create_and_get_data"] = make_result(MESSAGE_CREATE_ITERATIONS, time->get_ticks_usec() - start);
+
+	stub->reset();
+	return results;
+}
+
+Dictionary MetaToolkitBenchmarks::run_message_dispatch() {
+	Time *time = Time::get_singleton();
+	MetaPlatformSDK_Stub *stub = MetaPlatformSDK_Stub::get_singleton();
+	Dictionary results;
+
+	stub->reset();
+	Dictionary user;
+	user["ID"] = 1;
+	user["DisplayName"] = "Benchmark";
+	Dictionary response;
+	response["data"] = user;
+	stub->set_response(ovrMessage_User_Get, response);
+
+	// Decoding a new message each time, so the cached data isn't returned instead.
+	uint64_t start = time->get_ticks_usec();
+	for (uint64_t i = 0; i < MESSAGE_CREATE_ITERATIONS; i++) {
+		stub->_request(ovrMessage_User_Get);
+		Ref<MetaPlatformSDK_Message> message = MetaPlatformSDK_Message::_create_with_ovr_handle(ovr_PopMessage());
+		benchmark_sink = benchmark_sink + message->get_data().get_type();
+	}
+	results["get_data_table"] = make_result(MESSAGE_CREATE_ITERATIONS, time->get_ticks_usec() - start);
+
+	start = time->get_ticks_usec();
+	for (uint64_t i = 0; i < MESSAGE_CREATE_ITERATIONS; i++) {
+		stub->_request(ovrMessage_User_Get);
+		Ref<MetaPlatformSDK_Message> message = MetaPlatformSDK_Message::_create_with_ovr_handle(ovr_PopMessage());
+		benchmark_sink = benchmark_sink + message->_get_data_with_switch().get_type();
+	}
+	results["get_data_switch"] = make_result(MESSAGE_CREATE_ITERATIONS, time->get_ticks_usec() - start);
+
+	// Name lookup doesn't touch the handle, so one message will do.
+	stub->_request(ovrMessage_User_Get);
+	Ref<MetaPlatformSDK_Message> message = MetaPlatformSDK_Message::_create_with_ovr_handle(ovr_PopMessage());
+
+	start = time->get_ticks_usec();
+	for (uint64_t i = 0; i < MESSAGE_DISPATCH_ITERATIONS; i++) {
+		benchmark_sink = benchmark_sink + message->get_type_as_string().length();
+	}
+	results["type_as_string_table"] = make_result(MESSAGE_DISPATCH_ITERATIONS, time->get_ticks_usec() - start);
+
+	start = time->get_ticks_usec();
+	for (uint64_t i = 0; i < MESSAGE_DISPATCH_ITERATIONS; i++) {
+		benchmark_sink = benchmark_sink + message->_get_type_as_string_with_switch().length();
+	}
+	results["type_as_string_switch"] = make_result(MESSAGE_DISPATCH_ITERATIONS, time->get_ticks_usec() - start);
+
+	message.unref();
+	stub->reset();
+	return results;
+}
+
+Dictionary MetaToolkitBenchmarks::run_array_iteration() {
+	Time *time = Time::get_singleton();
+	Dictionary results;
+
+	Array rows;
+	for (int64_t i = 0; i < ARRAY_ITERATION_SIZE; i++) {
+		Dictionary user;
+		user["ID"] = i + 1;
+		user["DisplayName"] = vformat("Player %d", i + 1);
+		Dictionary row;
+		row["Rank"] = i + 1;
+		row["Score"] = (ARRAY_ITERATION_SIZE - i) * 100;
+		row["DisplayScore"] = itos((ARRAY_ITERATION_SIZE - i) * 100);
+		row["User"] = user;
+		rows.push_back(row);
+	}
+
+	MetaPlatformSDKStubObject *payload = memnew(MetaPlatformSDKStubObject(rows));
+	Ref<MetaPlatformSDK_LeaderboardEntryArray> array = MetaPlatformSDK_LeaderboardEntryArray::_create_with_ovr_handle((ovrLeaderboardEntryArrayHandle)payload);
+	uint64_t operations = ARRAY_ITERATION_PASSES * ARRAY_ITERATION_SIZE;
+
+	// Let the stub create its element objects up front, so that isn't measured.
+	benchmark_sink = benchmark_sink + array->to_columns().size();
+
+	// What a GDScript 'for entry in array' loop does.
+	Array iter;
+	iter.resize(1);
+	uint64_t start = time->get_ticks_usec();
+	for (uint64_t pass = 0; pass < ARRAY_ITERATION_PASSES; pass++) {
+		for (bool more = array->_iter_init(iter); more; more = array->_iter_next(iter)) {
+			Ref<MetaPlatformSDK_LeaderboardEntry> entry = array->_iter_get(iter[0]);
+			benchmark_sink = benchmark_sink + entry->get_score();
+		}
+	}
+	results["iter_get"] = make_result(operations, time->get_ticks_usec() - start);
+
+	start = time->get_ticks_usec();
+	for (uint64_t pass = 0; pass < ARRAY_ITERATION_PASSES; pass++) {
+		uint64_t size = array->size();
+		for (uint64_t i = 0; i < size; i++) {
+			benchmark_sink = benchmark_sink + array->get_element(i)->get_score();
+		}
+	}
+	results["get_element"] = make_result(operations, time->get_ticks_usec() - start);
+
+	// Bulk access decodes every column, not just the score.
+	start = time->get_ticks_usec();
+	for (uint64_t pass = 0; pass < ARRAY_ITERATION_PASSES; pass++) {
+		PackedInt64Array scores = array->to_columns()["score"];
+		for (int64_t score : scores) {
+			benchmark_sink = benchmark_sink + score;
+		}
+	}
+	results["to_columns"] = make_result(operations, time->get_ticks_usec() - start);
+
+	array.unref();
+	memdelete(payload);
+	return results;
+}
+
+Dictionary MetaToolkitBenchmarks::run_get_bytes() {
+	Time *time = Time::get_singleton();
+	Dictionary results;
+
+	const uint64_t sizes[] = { 1024, 64 * 1024, 4 * 1024 * 1024 };
+	for (uint64_t size : sizes) {
+		PackedByteArray bytes;
+		bytes.resize(size);
+		bytes.fill(0xAB);
+		Dictionary fields;
+		fields["Bytes"] = bytes;
+		fields["Size"] = size;
+
+		MetaPlatformSDKStubObject *payload = memnew(MetaPlatformSDKStubObject(fields));
+		Ref<MetaPlatformSDK_HttpTransferUpdate> update = MetaPlatformSDK_HttpTransferUpdate::_create_with_ovr_handle((ovrHttpTransferUpdateHandle)payload);
+		uint64_t iterations = MAX(BYTE_COPY_TOTAL_BYTES / size, (uint64_t)16);
+
+		uint64_t start = time->get_ticks_usec();
+		for (uint64_t i = 0; i < iterations; i++) {
+			PackedByteArray copy = update->get_bytes();
+			benchmark_sink = benchmark_sink + copy[size - 1];
+		}
+		Dictionary get_bytes = make_result(iterations, time->get_ticks_usec() - start);
+
+		Ref<MetaPlatformSDK_ByteBuffer> buffer = MetaPlatformSDK_ByteBuffer::acquire(size);
+		start = time->get_ticks_usec();
+		for (uint64_t i = 0; i < iterations; i++) {
+			benchmark_sink = benchmark_sink + update->get_bytes_into(buffer, 0);
+		}
+		Dictionary get_bytes_into = make_result(iterations, time->get_ticks_usec() - start);
+		buffer->release();
+
+		update.unref();
+		memdelete(payload);
+
+		Dictionary result;
+		result["get_bytes"] = get_bytes;
+		result["get_bytes_into"] = get_bytes_into;
+		results[itos(size)] = result;
+	}
+
+	return results;
+}
+#endif // META_PLATFORM_SDK_STUB
+
+Dictionary MetaToolkitBenchmarks::run_all() {
+	Dictionary results;
+	results["byte_copy"] = run_byte_copy();
+	results["request_table"] = run_request_table();
+#ifdef META_PLATFORM_SDK_STUB
+	results["message_pump"] = run_message_pump();
+	results["message_create"] = run_message_create();
+	results["message_dispatch"] = run_message_dispatch();
+	results["array_iteration"] = run_array_iteration();
+	results["get_bytes"] = run_get_bytes();
+#else
+	PackedStringArray skipped;
+	skipped.push_back("message_pump");
+	skipped.push_back("message_create");
+	skipped.push_back("message_dispatch");
+	skipped.push_back("array_iteration");
+	skipped.push_back("get_bytes");
+	results["skipped"] = skipped;
+#endif // META_PLATFORM_SDK_STUB
+	return results;
+}
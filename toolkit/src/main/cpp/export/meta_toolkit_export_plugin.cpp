@@ -2,16 +2,22 @@
 
 #include "export/meta_toolkit_export_plugin.h"
 
+#include <godot_cpp/classes/config_file.hpp>
 #include <godot_cpp/classes/editor_export_platform_android.hpp>
 #include <godot_cpp/classes/file_access.hpp>
 #include <godot_cpp/classes/project_settings.hpp>
 
+#include "meta_toolkit_performance_settings.h"
+
 using namespace godot;
 
 namespace {
 static const char *TOOLKIT_BUILD_TEMPLATE_ZIP_PATH = "res://addons/godot_meta_toolkit/.build_template/quest_build_template.zip";
 static const char *TOOLKIT_DEBUG_KEYSTORE_PATH = "res://addons/godot_meta_toolkit/.build_template/keystore/debug.keystore";
 static const char *TOOLKIT_DEBUG_KEYSTORE_PROPERTIES_PATH = "res://addons/godot_meta_toolkit/.build_template/keystore/debug.keystore.properties";
+
+static const char *PERFORMANCE_LEVEL_HINT = "Default:-1,Power Savings:0,Sustained Low:1,Sustained High:2,Boost:3";
+static const int PERFORMANCE_LEVEL_BOOST = 3;
 } // namespace
 
 MetaToolkitExportPlugin::MetaToolkitExportPlugin() {
@@ -24,6 +30,61 @@ MetaToolkitExportPlugin::MetaToolkitExportPlugin() {
 			PROPERTY_USAGE_DEFAULT,
 			false,
 			true);
+
+	_performance_options.append(_generate_export_option(
+			"meta_toolkit/performance/display_refresh_rate",
+			"",
+			Variant::Type::INT,
+			PROPERTY_HINT_ENUM,
+			"Default:0,72 Hz:72,80 Hz:80,90 Hz:90,120 Hz:120",
+			PROPERTY_USAGE_DEFAULT,
+			0,
+			false));
+	_performance_options.append(_generate_export_option(
+			"meta_toolkit/performance/cpu_level",
+			"",
+			Variant::Type::INT,
+			PROPERTY_HINT_ENUM,
+			PERFORMANCE_LEVEL_HINT,
+			PROPERTY_USAGE_DEFAULT,
+			-1,
+			false));
+	_performance_options.append(_generate_export_option(
+			"meta_toolkit/performance/gpu_level",
+			"",
+			Variant::Type::INT,
+			PROPERTY_HINT_ENUM,
+			PERFORMANCE_LEVEL_HINT,
+			PROPERTY_USAGE_DEFAULT,
+			-1,
+			false));
+	_performance_options.append(_generate_export_option(
+			"meta_toolkit/performance/foveation_level",
+			"",
+			Variant::Type::INT,
+			PROPERTY_HINT_ENUM,
+			"Default:-1,Off:0,Low:1,Medium:2,High:3",
+			PROPERTY_USAGE_DEFAULT,
+			-1,
+			false));
+	_performance_options.append(_generate_export_option(
+			"meta_toolkit/performance/foveation_dynamic",
+			"",
+			Variant::Type::BOOL,
+			PROPERTY_HINT_NONE,
+			"",
+			PROPERTY_USAGE_DEFAULT,
+			false,
+			false));
+	_performance_options.append(_generate_export_option(
+			"meta_toolkit/performance/strip_doc_data",
+			"",
+			Variant::Type::BOOL,
+			PROPERTY_HINT_NONE,
+			"",
+			PROPERTY_USAGE_DEFAULT,
+			false,
+			false));
 }
 
 void MetaToolkitExportPlugin::_bind_methods() {}
@@ -64,6 +125,19 @@ bool MetaToolkitExportPlugin::_get_bool_option(const godot::String &p_option) co
 	return false;
 }
 
+int MetaToolkitExportPlugin::_get_int_option(const godot::String &p_option, int p_default_value) const {
+	Variant option_value = get_option(p_option);
+	if (option_value.get_type() == Variant::Type::INT) {
+		return option_value;
+	}
+	return p_default_value;
+}
+
+String MetaToolkitExportPlugin::_get_toolkit_aar_file_path(bool p_debug) const {
+	const String debug_label = p_debug ? "debug" : "release";
+	return "res://addons/godot_meta_toolkit/.bin/android/" + debug_label + "/godot_meta_toolkit-" + debug_label + ".aar";
+}
+
 TypedArray<Dictionary> MetaToolkitExportPlugin::_get_export_options(const Ref<godot::EditorExportPlatform> &p_platform) const {
 	TypedArray<Dictionary> export_options;
 	if (!_supports_platform(p_platform)) {
@@ -71,15 +145,78 @@ TypedArray<Dictionary> MetaToolkitExportPlugin::_get_export_options(const Ref<go
 	}
 
 	export_options.append(_enable_meta_toolkit_option);
+	export_options.append_array(_performance_options);
 
 	return export_options;
 }
 
 String MetaToolkitExportPlugin::_get_export_option_warning(
 		const Ref<godot::EditorExportPlatform> &p_platform, const godot::String &p_option) const {
+	if (!_supports_platform(p_platform) || !_get_bool_option("meta_toolkit/enable_meta_toolkit")) {
+		return "";
+	}
+
+	if (p_option == "meta_toolkit/performance/display_refresh_rate") {
+		int refresh_rate = _get_int_option(p_option, 0);
+		if (refresh_rate != 0 && refresh_rate != 72 && refresh_rate != 80 && refresh_rate != 90 && refresh_rate != 120) {
+			return vformat("%d Hz isn't a refresh rate supported by Meta Quest headsets.\n", refresh_rate);
+		}
+		if (refresh_rate == 120) {
+			return "120 Hz isn't available on every headset. The highest available rate below it will be used instead.\n";
+		}
+	} else if (p_option == "meta_toolkit/performance/cpu_level" || p_option == "meta_toolkit/performance/gpu_level") {
+		int level = _get_int_option(p_option, -1);
+		if (level < -1 || level > PERFORMANCE_LEVEL_BOOST) {
+			return vformat("%d isn't a valid performance level.\n", level);
+		}
+		if (level == PERFORMANCE_LEVEL_BOOST) {
+			return "\"Boost\" can only be sustained for a short time before the headset throttles. Consider raising it at runtime, only while needed.\n";
+		}
+	} else if (p_option == "meta_toolkit/performance/foveation_level") {
+		int level = _get_int_option(p_option, -1);
+		if (level < -1 || level > 3) {
+			return vformat("%d isn't a valid foveation level.\n", level);
+		}
+	} else if (p_option == "meta_toolkit/performance/foveation_dynamic") {
+		if (_get_bool_option(p_option) && _get_int_option("meta_toolkit/performance/foveation_level", -1) <= 0) {
+			return "Dynamic foveation needs a foveation level other than \"Default\" or \"Off\" to have any effect.\n";
+		}
+	} else if (p_option == "meta_toolkit/performance/strip_doc_data") {
+		if (_get_bool_option(p_option) && !FileAccess::file_exists(_get_toolkit_aar_file_path(false))) {
+			return "The release build of the Godot Meta Toolkit isn't available, so the doc data can't be stripped from debug exports.\n";
+		}
+	}
+
 	return "";
 }
 
+void MetaToolkitExportPlugin::_export_begin(const PackedStringArray &p_features, bool p_is_debug, const String &p_path, uint32_t p_flags) {
+	if (!_get_bool_option("meta_toolkit/enable_meta_toolkit")) {
+		return;
+	}
+
+	int refresh_rate = _get_int_option("meta_toolkit/performance/display_refresh_rate", 0);
+	int cpu_level = _get_int_option("meta_toolkit/performance/cpu_level", -1);
+	int gpu_level = _get_int_option("meta_toolkit/performance/gpu_level", -1);
+	int foveation_level = _get_int_option("meta_toolkit/performance/foveation_level", -1);
+	if (refresh_rate <= 0 && cpu_level < 0 && gpu_level < 0 && foveation_level < 0) {
+		return;
+	}
+
+	// There's no manifest metadata for these on Quest, so they're applied by MetaToolkitPerformanceSettings
+	// once the OpenXR session starts.
+	Ref<ConfigFile> config;
+	config.instantiate();
+	const String section = MetaToolkitPerformanceSettings::SETTINGS_SECTION;
+	config->set_value(section, "display_refresh_rate", refresh_rate);
+	config->set_value(section, "cpu_level", cpu_level);
+	config->set_value(section, "gpu_level", gpu_level);
+	config->set_value(section, "foveation_level", foveation_level);
+	config->set_value(section, "foveation_dynamic", _get_bool_option("meta_toolkit/performance/foveation_dynamic"));
+
+	add_file(MetaToolkitPerformanceSettings::SETTINGS_PATH, config->encode_to_text().to_utf8_buffer(), false);
+}
+
 Dictionary MetaToolkitExportPlugin::_get_export_options_overrides(
 		const Ref<godot::EditorExportPlatform> &p_platform) const {
 	Dictionary overrides;
@@ -168,9 +305,14 @@ PackedStringArray MetaToolkitExportPlugin::_get_android_libraries(const Ref<godo
 		return dependencies;
 	}
 
+	// The doc data is only compiled into the debug build, where it's never used on the headset.
+	bool use_debug_build = p_debug;
+	if (use_debug_build && _get_bool_option("meta_toolkit/enable_meta_toolkit") && _get_bool_option("meta_toolkit/performance/strip_doc_data") && FileAccess::file_exists(_get_toolkit_aar_file_path(false))) {
+		use_debug_build = false;
+	}
+
 	// Check if the Godot Meta toolkit aar dependency is available
-	const String debug_label = p_debug ? "debug" : "release";
-	const String toolkit_aar_file_path = "res://addons/godot_meta_toolkit/.bin/android/" + debug_label + "/godot_meta_toolkit-" + debug_label + ".aar";
+	const String toolkit_aar_file_path = _get_toolkit_aar_file_path(use_debug_build);
 	if (FileAccess::file_exists(toolkit_aar_file_path)) {
 		dependencies.append(toolkit_aar_file_path);
 	}
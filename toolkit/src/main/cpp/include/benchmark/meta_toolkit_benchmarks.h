@@ -0,0 +1,30 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/ref_counted.hpp>
+
+using namespace godot;
+
+// Micro-benchmarks for the hot paths in the bindings, only built with 'scons benchmarks=yes'.
+//
+// The benchmarks that go through the Platform SDK also need 'platform_sdk_stub=yes', otherwise they're
+// reported as skipped. Run them headless with 'scripts/run_benchmarks.gd'.
+class MetaToolkitBenchmarks : public RefCounted {
+	GDCLASS(MetaToolkitBenchmarks, RefCounted);
+
+protected:
+	static void _bind_methods();
+
+public:
+	Dictionary run_byte_copy();
+	Dictionary run_request_table();
+#ifdef META_PLATFORM_SDK_STUB
+	Dictionary run_message_pump();
+	Dictionary run_message_create();
+	Dictionary run_message_dispatch();
+	Dictionary run_array_iteration();
+	Dictionary run_get_bytes();
+#endif // META_PLATFORM_SDK_STUB
+	Dictionary run_all();
+};
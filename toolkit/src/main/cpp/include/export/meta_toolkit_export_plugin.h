@@ -27,6 +27,8 @@ public:
 
 	bool _supports_platform(const Ref<EditorExportPlatform> &p_platform) const override;
 
+	void _export_begin(const PackedStringArray &p_features, bool p_is_debug, const String &p_path, uint32_t p_flags) override;
+
 protected:
 	static void _bind_methods();
 
@@ -40,6 +42,9 @@ private:
 			bool p_update_visibility);
 
 	bool _get_bool_option(const String &p_option) const;
+	int _get_int_option(const String &p_option, int p_default_value) const;
+	String _get_toolkit_aar_file_path(bool p_debug) const;
 
 	Dictionary _enable_meta_toolkit_option;
+	TypedArray<Dictionary> _performance_options;
 };
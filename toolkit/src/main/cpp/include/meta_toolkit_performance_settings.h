@@ -0,0 +1,38 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/object.hpp>
+
+using namespace godot;
+
+class OpenXRInterface;
+
+// Applies the performance settings chosen in the export preset (see MetaToolkitExportPlugin) to the
+// OpenXR session, so every build runs with the same, known configuration.
+class MetaToolkitPerformanceSettings : public Object {
+	GDCLASS(MetaToolkitPerformanceSettings, Object);
+
+	static MetaToolkitPerformanceSettings *singleton;
+
+	float display_refresh_rate = 0.0;
+	int32_t cpu_level = -1;
+	int32_t gpu_level = -1;
+	int32_t foveation_level = -1;
+	bool foveation_dynamic = false;
+
+	bool _connect_to_interface();
+	void _on_interface_added(const StringName &p_interface_name);
+	void _on_session_begun();
+
+protected:
+	static void _bind_methods() {}
+
+public:
+	// Written into the exported project by MetaToolkitExportPlugin.
+	static constexpr const char *SETTINGS_PATH = "res://addons/godot_meta_toolkit/performance.cfg";
+	static constexpr const char *SETTINGS_SECTION = "performance";
+
+	static void initialize();
+	static void finalize();
+};
@@ -0,0 +1,36 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/variant/dictionary.hpp>
+
+#include <atomic>
+
+using namespace godot;
+
+// Counts the objects created and freed for one of the wrapper classes, to show how much allocation churn
+// the bindings cause. Each generated class has a static counter, and they all link themselves into a list.
+class MetaPlatformSDKAllocationCounter {
+	static MetaPlatformSDKAllocationCounter *first;
+
+	const char *class_name;
+	MetaPlatformSDKAllocationCounter *next;
+	// Wrappers may be released from any thread that held a reference.
+	std::atomic<uint64_t> created = { 0 };
+	std::atomic<uint64_t> freed = { 0 };
+	std::atomic<uint64_t> reused = { 0 };
+
+public:
+	_FORCE_INLINE_ void on_create() { created.fetch_add(1, std::memory_order_relaxed); }
+	_FORCE_INLINE_ void on_free() { freed.fetch_add(1, std::memory_order_relaxed); }
+	// Called when an object is handed out again by a MetaPlatformSDKObjectPool, instead of being created.
+	_FORCE_INLINE_ void on_reuse() { reused.fetch_add(1, std::memory_order_relaxed); }
+
+	// Returns the counts for every class that has had an object created, keyed by class name.
+	static Dictionary get_stats();
+
+	MetaPlatformSDKAllocationCounter(const char *p_class_name) :
+			class_name(p_class_name), next(first) {
+		first = this;
+	}
+};
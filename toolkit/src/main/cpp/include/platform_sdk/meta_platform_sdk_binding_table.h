@@ -0,0 +1,58 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/core/class_db.hpp>
+
+#include <iterator>
+
+using namespace godot;
+
+// The generated classes describe most of their methods in static tables, which are registered by the
+// shared routines below. This way, each class only instantiates the binding code once for each
+// distinct signature, rather than once for every method.
+//
+// TODO: Each getter still has its own compiled body; they aren't shared per return type yet. The effect on
+// the library size and on registration time (printed with --verbose) hasn't been measured on a device build.
+
+template <typename T, typename R>
+struct MetaPlatformSDKGetterBinding {
+	const char *method;
+	// The read-only property to add for the getter, or nullptr for none.
+	const char *property;
+	Variant::Type type;
+	PropertyHint hint;
+	const char *hint_string;
+	R (T::*getter)() const;
+};
+
+template <typename T, typename R>
+struct MetaPlatformSDKMethodBinding {
+	const char *method;
+	R (T::*function)();
+};
+
+struct MetaPlatformSDKConstantBinding {
+	const char *name;
+	int64_t value;
+};
+
+template <typename T, typename R>
+void meta_platform_sdk_bind_getters(const MetaPlatformSDKGetterBinding<T, R> *p_bindings, size_t p_count) {
+	for (size_t i = 0; i < p_count; i++) {
+		const MetaPlatformSDKGetterBinding<T, R> &binding = p_bindings[i];
+		ClassDB::bind_method(D_METHOD(binding.method), binding.getter);
+		if (binding.property != nullptr) {
+			ClassDB::add_property(T::get_class_static(), PropertyInfo(binding.type, binding.property, binding.hint, binding.hint_string), "", binding.method);
+		}
+	}
+}
+
+template <typename T, typename R>
+void meta_platform_sdk_bind_methods(const MetaPlatformSDKMethodBinding<T, R> *p_bindings, size_t p_count) {
+	for (size_t i = 0; i < p_count; i++) {
+		ClassDB::bind_method(D_METHOD(p_bindings[i].method), p_bindings[i].function);
+	}
+}
+
+void meta_platform_sdk_bind_enum(const StringName &p_class, const StringName &p_enum, const MetaPlatformSDKConstantBinding *p_constants, size_t p_count);
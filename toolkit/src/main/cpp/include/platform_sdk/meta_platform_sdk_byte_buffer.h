@@ -0,0 +1,38 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+
+using namespace godot;
+
+// A reusable byte buffer that binary data from the Platform SDK can be copied into without allocating on every call.
+class MetaPlatformSDK_ByteBuffer : public RefCounted {
+	GDCLASS(MetaPlatformSDK_ByteBuffer, RefCounted);
+
+	static const uint32_t MAX_POOLED_BUFFERS = 16;
+	static LocalVector<Ref<MetaPlatformSDK_ByteBuffer>> pool;
+
+	PackedByteArray data;
+	bool pooled = false;
+
+protected:
+	static void _bind_methods();
+	String _to_string() const;
+
+public:
+	// Copies the given bytes into the buffer at the offset, growing it if necessary. Returns the number of bytes written.
+	int64_t _write(const void *p_data, size_t p_size, int64_t p_offset);
+
+	static Ref<MetaPlatformSDK_ByteBuffer> acquire(int64_t p_min_size);
+	void release();
+	static void _clear_pool();
+
+	inline PackedByteArray get_data() const { return data; }
+	inline int64_t get_size() const { return data.size(); }
+	void resize(int64_t p_size);
+
+	MetaPlatformSDK_ByteBuffer();
+};
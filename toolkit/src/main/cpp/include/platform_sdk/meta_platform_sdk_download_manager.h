@@ -0,0 +1,86 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+
+#include "platform_sdk/meta_platform_sdk_request.h"
+
+using namespace godot;
+
+class MetaPlatformSDK_Message;
+
+// Downloads asset files a few at a time, in priority order, and reports their combined progress.
+class MetaPlatformSDK_DownloadManager : public Node {
+	GDCLASS(MetaPlatformSDK_DownloadManager, Node);
+
+public:
+	enum DownloadStatus {
+		DOWNLOAD_QUEUED,
+		DOWNLOAD_ACTIVE,
+		DOWNLOAD_PAUSED,
+		DOWNLOAD_COMPLETED,
+		DOWNLOAD_FAILED,
+	};
+
+private:
+	struct Download {
+		int32_t priority = 0;
+		// Breaks ties between downloads with the same priority, so they start in the order they were added.
+		uint64_t sequence = 0;
+		DownloadStatus status = DOWNLOAD_QUEUED;
+		int64_t bytes_transferred = 0;
+		int64_t bytes_total = 0;
+		String file_path;
+		bool load_resource_pack = false;
+		// Whether the Platform SDK has accepted the download, and we're waiting on updates.
+		bool started = false;
+	};
+
+	HashMap<uint64_t, Download> downloads;
+	uint64_t next_sequence = 0;
+
+	int32_t max_concurrent_downloads = 2;
+	double progress_interval = 0.25;
+	bool progress_changed = false;
+	uint64_t last_progress_usec = 0;
+
+	int32_t _count(DownloadStatus p_status) const;
+	void _start_next();
+	bool _start(uint64_t p_asset_file_id, Download &p_download);
+	void _stop(uint64_t p_asset_file_id);
+	void _emit_progress();
+
+	void _on_download_started(const Ref<MetaPlatformSDK_Message> &p_message, uint64_t p_asset_file_id);
+	void _on_download_update(const Ref<MetaPlatformSDK_Message> &p_message);
+	void _on_download_timed_out(uint64_t p_asset_file_id);
+	void _load_resource_pack(uint64_t p_asset_file_id, const String &p_file_path);
+
+protected:
+	static void _bind_methods();
+	void _notification(int p_what);
+
+public:
+	void set_max_concurrent_downloads(int32_t p_max_downloads);
+	inline int32_t get_max_concurrent_downloads() const { return max_concurrent_downloads; }
+	void set_progress_interval(double p_seconds);
+	inline double get_progress_interval() const { return progress_interval; }
+
+	void enqueue(uint64_t p_asset_file_id, int32_t p_priority, bool p_load_resource_pack);
+	void set_priority(uint64_t p_asset_file_id, int32_t p_priority);
+	void pause(uint64_t p_asset_file_id);
+	void resume(uint64_t p_asset_file_id);
+	void cancel(uint64_t p_asset_file_id);
+	void clear_finished();
+
+	bool has_download(uint64_t p_asset_file_id) const;
+	DownloadStatus get_download_status(uint64_t p_asset_file_id) const;
+	Dictionary get_download(uint64_t p_asset_file_id) const;
+	PackedInt64Array get_download_ids() const;
+	Dictionary get_progress() const;
+
+	MetaPlatformSDK_DownloadManager();
+};
+
+VARIANT_ENUM_CAST(MetaPlatformSDK_DownloadManager::DownloadStatus);
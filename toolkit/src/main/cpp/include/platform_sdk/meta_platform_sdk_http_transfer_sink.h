@@ -0,0 +1,58 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/ref.hpp>
+
+#include "platform_sdk/meta_platform_sdk_byte_buffer.h"
+
+using namespace godot;
+
+// Receives the chunks of an HTTP transfer natively, writing them to a file or a byte buffer as they arrive,
+// so they never have to cross into script.
+class MetaPlatformSDK_HttpTransferSink : public RefCounted {
+	GDCLASS(MetaPlatformSDK_HttpTransferSink, RefCounted);
+
+	String path;
+	Ref<FileAccess> file;
+	// Reused for every chunk written to the file, since FileAccess only accepts a PackedByteArray.
+	PackedByteArray file_chunk;
+
+	Ref<MetaPlatformSDK_ByteBuffer> buffer;
+	int64_t buffer_offset = 0;
+
+	uint64_t transfer_id = 0;
+	int64_t bytes_written = 0;
+	// When the sink was registered, or last received a chunk.
+	uint64_t last_update_usec = 0;
+	double idle_timeout = 30.0;
+	uint32_t crc = 0xFFFFFFFF;
+	bool finished = false;
+
+protected:
+	static void _bind_methods();
+	String _to_string() const;
+
+public:
+	static Ref<MetaPlatformSDK_HttpTransferSink> create_for_file(const String &p_path);
+	static Ref<MetaPlatformSDK_HttpTransferSink> create_for_buffer(const Ref<MetaPlatformSDK_ByteBuffer> &p_buffer, int64_t p_offset);
+
+	void _set_transfer_id(uint64_t p_transfer_id);
+	_FORCE_INLINE_ bool _is_idle(uint64_t p_now_usec) const {
+		return idle_timeout > 0.0 && p_now_usec - last_update_usec >= (uint64_t)(idle_timeout * 1000000.0);
+	}
+	void _append(const void *p_data, size_t p_size);
+	void _finish();
+	void _fail(const String &p_error);
+
+	inline uint64_t get_transfer_id() const { return transfer_id; }
+	inline int64_t get_bytes_written() const { return bytes_written; }
+	inline int64_t get_checksum() const { return crc ^ 0xFFFFFFFF; }
+	inline bool is_finished() const { return finished; }
+
+	void set_idle_timeout(double p_seconds);
+	inline double get_idle_timeout() const { return idle_timeout; }
+
+	MetaPlatformSDK_HttpTransferSink();
+};
@@ -0,0 +1,43 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+using namespace godot;
+
+// Counts request latencies in power-of-two buckets, so it takes the same memory no matter how many are recorded.
+//
+// The first bucket holds everything under 128 usec, and the last everything over 8 seconds, which is
+// plenty of resolution for telling a slow API from a fast one.
+struct MetaPlatformSDKLatencyHistogram {
+	static const uint32_t BUCKET_COUNT = 18;
+	static const uint32_t FIRST_BUCKET_SHIFT = 7;
+
+	uint32_t buckets[BUCKET_COUNT] = {};
+	uint64_t count = 0;
+	uint64_t total_usec = 0;
+	uint64_t max_usec = 0;
+
+	void record(uint64_t p_usec);
+	// Estimates the latency below which the given fraction (0 to 1) of requests completed.
+	double get_percentile_usec(double p_fraction) const;
+	_FORCE_INLINE_ double get_mean_usec() const { return count > 0 ? (double)total_usec / (double)count : 0.0; }
+
+	static uint64_t get_bucket_upper_bound_usec(uint32_t p_bucket);
+};
+
+// Keeps a latency histogram for each message type that has had a response.
+class MetaPlatformSDKLatencyStats {
+	HashMap<int32_t, MetaPlatformSDKLatencyHistogram> histograms;
+
+public:
+	// Returns true if this is the first latency recorded for the message type.
+	bool record(int32_t p_message_type, uint64_t p_usec);
+	const MetaPlatformSDKLatencyHistogram *get(int32_t p_message_type) const;
+	_FORCE_INLINE_ const HashMap<int32_t, MetaPlatformSDKLatencyHistogram> &get_all() const { return histograms; }
+
+	static Dictionary histogram_to_dictionary(const MetaPlatformSDKLatencyHistogram &p_histogram);
+	void clear();
+};
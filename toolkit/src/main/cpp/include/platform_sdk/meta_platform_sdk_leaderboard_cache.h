@@ -0,0 +1,85 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+#include "platform_sdk/meta_platform_sdk_leaderboard_window.h"
+#include "platform_sdk/meta_platform_sdk_request.h"
+
+using namespace godot;
+
+class MetaPlatformSDK_Message;
+
+// Caches leaderboard entries by rank, so overlapping windows only fetch the ranges that are missing or stale.
+class MetaPlatformSDK_LeaderboardCache : public RefCounted {
+	GDCLASS(MetaPlatformSDK_LeaderboardCache, RefCounted);
+
+	struct CachedEntry {
+		Dictionary row;
+		uint64_t fetched_usec = 0;
+	};
+
+	struct Board {
+		HashMap<int64_t, CachedEntry> entries;
+		// The rank just past the last entry, if we've seen the end of the leaderboard.
+		int64_t end_rank = 0;
+		uint64_t end_fetched_usec = 0;
+		int64_t viewer_rank = 0;
+		uint64_t viewer_fetched_usec = 0;
+	};
+
+	struct Range {
+		int64_t start = 0;
+		int64_t count = 0;
+	};
+
+	HashMap<String, Board> boards;
+	uint32_t entry_count = 0;
+
+	double ttl = 30.0;
+	int32_t max_entries = 5000;
+
+	uint64_t hits = 0;
+	uint64_t misses = 0;
+	uint64_t requests_issued = 0;
+	uint64_t evictions = 0;
+
+	_FORCE_INLINE_ bool _is_fresh(uint64_t p_fetched_usec, uint64_t p_now_usec) const {
+		return p_fetched_usec != 0 && p_now_usec - p_fetched_usec < (uint64_t)(ttl * 1000000.0);
+	}
+
+	void _find_gaps(const Board &p_board, int64_t p_start_rank, int64_t p_count, uint64_t p_now_usec, LocalVector<Range> &r_gaps) const;
+	TypedArray<Dictionary> _collect(const Board &p_board, int64_t p_start_rank, int64_t p_count);
+	int64_t _store_rows(Board &p_board, const Ref<MetaPlatformSDK_Message> &p_message, uint64_t p_now_usec, TypedArray<Dictionary> &r_rows, bool &r_has_next_page);
+	bool _request_range(const Ref<MetaPlatformSDK_LeaderboardWindow> &p_window, int64_t p_start_rank, int64_t p_count);
+	void _enforce_max_entries();
+
+	void _on_range_fetched(const Ref<MetaPlatformSDK_Message> &p_message, const Ref<MetaPlatformSDK_LeaderboardWindow> &p_window, int64_t p_start_rank, int64_t p_count);
+	void _on_viewer_window_fetched(const Ref<MetaPlatformSDK_Message> &p_message, const Ref<MetaPlatformSDK_LeaderboardWindow> &p_window);
+	void _on_window_request_timed_out(const Ref<MetaPlatformSDK_LeaderboardWindow> &p_window);
+	void _on_entry_written(const Ref<MetaPlatformSDK_Message> &p_message, const String &p_leaderboard_name, bool p_force_update);
+
+protected:
+	static void _bind_methods();
+	String _to_string() const;
+
+public:
+	void set_ttl(double p_seconds);
+	inline double get_ttl() const { return ttl; }
+	void set_max_entries(int32_t p_max_entries);
+	inline int32_t get_max_entries() const { return max_entries; }
+
+	Ref<MetaPlatformSDK_LeaderboardWindow> get_entries_async(const String &p_leaderboard_name, int64_t p_start_rank, int64_t p_count);
+	Ref<MetaPlatformSDK_LeaderboardWindow> get_entries_around_viewer_async(const String &p_leaderboard_name, int64_t p_count);
+	Ref<MetaPlatformSDK_Request> write_entry_async(const String &p_leaderboard_name, int64_t p_score, const PackedByteArray &p_extra_data, bool p_force_update);
+
+	void invalidate(const String &p_leaderboard_name);
+	void clear();
+	Dictionary get_stats() const;
+
+	MetaPlatformSDK_LeaderboardCache();
+};
@@ -0,0 +1,46 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+using namespace godot;
+
+class MetaPlatformSDK_Message;
+
+// A range of leaderboard entries requested through MetaPlatformSDK_LeaderboardCache.
+class MetaPlatformSDK_LeaderboardWindow : public RefCounted {
+	GDCLASS(MetaPlatformSDK_LeaderboardWindow, RefCounted);
+
+	friend class MetaPlatformSDK_LeaderboardCache;
+
+	String leaderboard_name;
+	int64_t start_rank = 0;
+	int64_t count = 0;
+	TypedArray<Dictionary> entries;
+	bool from_cache = false;
+	bool done = false;
+
+	// The number of ranges still being fetched.
+	int32_t pending_ranges = 0;
+
+	void _complete(const TypedArray<Dictionary> &p_entries, bool p_from_cache);
+	void _fail(const Ref<MetaPlatformSDK_Message> &p_message);
+	void _emit_completed(const Ref<MetaPlatformSDK_LeaderboardWindow> &p_self);
+	void _emit_failed(const Ref<MetaPlatformSDK_LeaderboardWindow> &p_self);
+
+protected:
+	static void _bind_methods();
+	String _to_string() const;
+
+public:
+	inline String get_leaderboard_name() const { return leaderboard_name; }
+	inline int64_t get_start_rank() const { return start_rank; }
+	inline int64_t get_count() const { return count; }
+	inline TypedArray<Dictionary> get_entries() const { return entries; }
+	inline bool is_from_cache() const { return from_cache; }
+	inline bool is_done() const { return done; }
+
+	MetaPlatformSDK_LeaderboardWindow();
+};
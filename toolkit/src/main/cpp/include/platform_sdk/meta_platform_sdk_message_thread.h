@@ -0,0 +1,75 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#ifdef META_PLATFORM_SDK_ENABLED
+#include <OVR_Message.h>
+#include <OVR_Types.h>
+
+#include <godot_cpp/classes/ref.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "spsc_ring_buffer.h"
+
+using namespace godot;
+
+class MetaPlatformSDK_Message;
+
+// A message that has been popped from the Platform SDK, but not dispatched yet.
+struct MetaPlatformSDKPendingMessage {
+	ovrMessageHandle handle = nullptr;
+	ovrMessageType type = ovrMessage_Unknown;
+	ovrRequest request_id = 0;
+	bool is_notification = false;
+	// Created along with its payload when the message was popped on the message thread. The wrapper then owns the handle.
+	Ref<MetaPlatformSDK_Message> message;
+
+	// Frees the native message, which the wrapper does itself if there is one.
+	void free();
+
+	static MetaPlatformSDKPendingMessage decode(ovrMessageHandle p_handle, bool p_decode_payload = false);
+};
+
+// Pops and decodes messages on a worker thread, and hands them over to the main thread through a lock-free ring buffer.
+//
+// The Platform SDK has no way to wait for a message, so the thread checks for new ones every millisecond, and
+// whenever the main thread wakes it after making room in the ring. That way, responses are usually decoded and
+// waiting by the time the next pump runs.
+class MetaPlatformSDKMessageThread {
+public:
+	typedef ovrMessageHandle (*PopMessageFunc)();
+
+private:
+	static const uint32_t DEFAULT_CAPACITY = 1024;
+	static const uint32_t POLL_INTERVAL_USEC = 1000;
+
+	PopMessageFunc pop_message_func = nullptr;
+	SPSCRingBuffer<MetaPlatformSDKPendingMessage> ring;
+	std::thread thread;
+	std::atomic<bool> running = { false };
+
+	std::mutex wake_mutex;
+	std::condition_variable wake_condition;
+	bool wake_pending = false;
+
+	void _thread_func();
+
+public:
+	// The pop function can be replaced to feed the thread from somewhere other than the Platform SDK.
+	void start(PopMessageFunc p_pop_message_func = ovr_PopMessage, uint32_t p_capacity = DEFAULT_CAPACITY);
+	void stop();
+	_FORCE_INLINE_ bool is_running() const { return running.load(std::memory_order_acquire); }
+
+	// Main thread only. Lets the thread pop whatever has arrived straight away, without waiting for the next poll.
+	void wake();
+	// Main thread only. After stop() this still returns the messages the thread popped before it stopped.
+	bool pop(MetaPlatformSDKPendingMessage &r_message);
+
+	~MetaPlatformSDKMessageThread();
+};
+#endif // META_PLATFORM_SDK_ENABLED
@@ -0,0 +1,103 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+#include <atomic>
+#include <mutex>
+
+#include "platform_sdk/meta_platform_sdk_allocation_counter.h"
+
+using namespace godot;
+
+// Recycles the wrapper objects for one of the result classes, rather than allocating a new one for every message.
+//
+// The pool keeps a reference to every object it hands out. Since godot-cpp can't hook into the last reference
+// being dropped, sweep() runs once per message pump, and recycles the objects that only the pool refers to
+// anymore: their native handle is freed, and they're kept for the next acquire().
+class MetaPlatformSDKObjectPoolBase {
+	static MetaPlatformSDKObjectPoolBase *first;
+	MetaPlatformSDKObjectPoolBase *next;
+
+protected:
+	// The maximum number of objects kept by each pool, or 0 to turn pooling off. Shared by all the pools.
+	static std::atomic<uint32_t> max_size;
+
+	virtual void _sweep() = 0;
+	virtual void _clear() = 0;
+
+public:
+	static void set_max_size(uint32_t p_max_size);
+	static inline uint32_t get_max_size() { return max_size.load(std::memory_order_relaxed); }
+
+	static void sweep_all();
+	// Drops all the pooled objects, which must be done before the engine shuts down.
+	static void clear_all();
+
+	MetaPlatformSDKObjectPoolBase() :
+			next(first) {
+		first = this;
+	}
+	virtual ~MetaPlatformSDKObjectPoolBase() {}
+};
+
+template <typename T>
+class MetaPlatformSDKObjectPool : public MetaPlatformSDKObjectPoolBase {
+	// Wrappers may be created from any thread that holds a result.
+	std::mutex mutex;
+	LocalVector<Ref<T>> in_use;
+	LocalVector<Ref<T>> idle;
+	MetaPlatformSDKAllocationCounter &allocation_counter;
+
+protected:
+	virtual void _sweep() override {
+		std::lock_guard<std::mutex> lock(mutex);
+		for (uint32_t i = 0; i < in_use.size();) {
+			if (in_use[i]->get_reference_count() > 1) {
+				i++;
+				continue;
+			}
+			in_use[i]->_recycle();
+			idle.push_back(in_use[i]);
+			in_use.remove_at_unordered(i);
+		}
+	}
+
+	virtual void _clear() override {
+		std::lock_guard<std::mutex> lock(mutex);
+		in_use.reset();
+		idle.reset();
+	}
+
+public:
+	Ref<T> acquire() {
+		uint32_t max = get_max_size();
+		if (max == 0) {
+			Ref<T> inst;
+			inst.instantiate();
+			return inst;
+		}
+
+		std::lock_guard<std::mutex> lock(mutex);
+		if (!idle.is_empty()) {
+			Ref<T> inst = idle[idle.size() - 1];
+			idle.resize(idle.size() - 1);
+			in_use.push_back(inst);
+			allocation_counter.on_reuse();
+			return inst;
+		}
+
+		Ref<T> inst;
+		inst.instantiate();
+		// Once the pool is full, the extra objects are freed as usual.
+		if (in_use.size() < max) {
+			in_use.push_back(inst);
+		}
+		return inst;
+	}
+
+	MetaPlatformSDKObjectPool(MetaPlatformSDKAllocationCounter &p_allocation_counter) :
+			allocation_counter(p_allocation_counter) {}
+};
@@ -0,0 +1,73 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/callable.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+#include "platform_sdk/meta_platform_sdk_request.h"
+
+using namespace godot;
+
+class MetaPlatformSDK_Message;
+
+// Fetches all the pages of a paginated result, requesting each page as soon as the previous one arrives.
+class MetaPlatformSDK_Pager : public RefCounted {
+	GDCLASS(MetaPlatformSDK_Pager, RefCounted);
+
+public:
+	// Generated for each paginated array class, so the pager can work with any of them.
+	struct PageFuncs {
+		bool (*has_next_page)(RefCounted *p_page);
+		Ref<MetaPlatformSDK_Request> (*request_next_page)(RefCounted *p_page);
+		Dictionary (*to_columns)(RefCounted *p_page);
+	};
+
+private:
+	const PageFuncs *funcs = nullptr;
+	Ref<MetaPlatformSDK_Message> first_message;
+	Ref<MetaPlatformSDK_Request> next_request;
+	// Keeps the pager alive while it's waiting on requests.
+	Ref<MetaPlatformSDK_Pager> self;
+
+	int32_t max_pages = 0;
+	bool merge_columns = false;
+	Callable page_callback;
+
+	int32_t pages_received = 0;
+	bool running = false;
+	LocalVector<Dictionary> page_columns;
+
+	void _handle_page(const Ref<MetaPlatformSDK_Message> &p_message);
+	void _on_next_page_completed(const Ref<MetaPlatformSDK_Message> &p_message);
+	void _on_next_page_failed();
+	Ref<MetaPlatformSDK_Request> _take_next_request();
+	void _stop();
+
+	static Dictionary _concat_columns(const LocalVector<Dictionary> &p_pages);
+
+protected:
+	static void _bind_methods();
+	String _to_string() const;
+
+public:
+	static Ref<MetaPlatformSDK_Pager> _create(const Ref<MetaPlatformSDK_Message> &p_first_message, const PageFuncs *p_funcs);
+
+	void set_max_pages(int32_t p_max_pages);
+	inline int32_t get_max_pages() const { return max_pages; }
+	void set_merge_columns(bool p_enable);
+	inline bool is_merge_columns() const { return merge_columns; }
+	void set_page_callback(const Callable &p_callback);
+	inline Callable get_page_callback() const { return page_callback; }
+
+	inline int32_t get_pages_received() const { return pages_received; }
+	inline bool is_running() const { return running; }
+
+	void start();
+	void cancel();
+
+	MetaPlatformSDK_Pager();
+	~MetaPlatformSDK_Pager();
+};
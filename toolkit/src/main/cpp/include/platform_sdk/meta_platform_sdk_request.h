@@ -2,34 +2,75 @@
 
 #pragma once
 
-#ifdef ANDROID_ENABLED
+#ifdef META_PLATFORM_SDK_ENABLED
 #include <OVR_Types.h>
-#endif // ANDROID_ENABLED
+#endif // META_PLATFORM_SDK_ENABLED
 
 #include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/callable.hpp>
 
 using namespace godot;
 
+class MetaPlatformSDK_Message;
+class MetaPlatformSDK_RequestGroup;
+
 class MetaPlatformSDK_Request : public RefCounted {
 	GDCLASS(MetaPlatformSDK_Request, RefCounted);
 
 	friend class MetaPlatformSDK;
+	friend class MetaPlatformSDKRequestCoalescer;
+
+public:
+	enum Status {
+		STATUS_PENDING,
+		STATUS_COMPLETED,
+		STATUS_CANCELLED,
+		STATUS_TIMED_OUT,
+	};
 
-#ifdef ANDROID_ENABLED
+private:
+#ifdef META_PLATFORM_SDK_ENABLED
 	ovrRequest id = 0;
-#endif // ANDROID_ENABLED
+	// For a coalesced request, which has no id of its own, the id of the request whose response it shares.
+	ovrRequest shared_id = 0;
+#endif // META_PLATFORM_SDK_ENABLED
+
+	Status status = STATUS_PENDING;
+
+	struct GroupSlot {
+		Ref<MetaPlatformSDK_RequestGroup> group;
+		uint32_t index = 0;
+	};
+
+	LocalVector<Callable> continuations;
+	// The groups are kept alive by their pending requests, so they still complete if nothing else refers to them.
+	LocalVector<GroupSlot> groups;
+
+	void _finish(Status p_status, const Ref<MetaPlatformSDK_Message> &p_message);
 
 protected:
 	static void _bind_methods();
 
 public:
 	inline uint64_t get_id() {
-#ifdef ANDROID_ENABLED
+#ifdef META_PLATFORM_SDK_ENABLED
 		return id;
 #else
 		return 0;
-#endif // ANDROID_ENABLED
+#endif // META_PLATFORM_SDK_ENABLED
 	}
 
+	inline Status get_status() const { return status; }
+
+	void cancel();
+	Ref<MetaPlatformSDK_Request> set_timeout(double p_seconds);
+	Ref<MetaPlatformSDK_Request> then(const Callable &p_continuation);
+
+	void _add_to_group(const Ref<MetaPlatformSDK_RequestGroup> &p_group, uint32_t p_index);
+
 	MetaPlatformSDK_Request();
+	~MetaPlatformSDK_Request();
 };
+
+VARIANT_ENUM_CAST(MetaPlatformSDK_Request::Status);
@@ -0,0 +1,41 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+#include "platform_sdk/meta_platform_sdk_request.h"
+
+using namespace godot;
+
+// Shares a single in-flight request between identical calls, so they only make one round trip to the server.
+//
+// The first call makes the real request, and any identical calls made before it completes get a follower
+// request, which completes with the same response.
+class MetaPlatformSDKRequestCoalescer {
+	struct InFlight {
+		uint64_t id = 0;
+		LocalVector<Ref<MetaPlatformSDK_Request>> followers;
+	};
+
+	HashMap<String, InFlight> in_flight;
+	HashMap<uint64_t, String> keys_by_id;
+	HashMap<String, uint64_t> saved_by_api;
+
+public:
+	// Returns a follower for an identical request that's already in flight, or a null reference if there isn't one.
+	Ref<MetaPlatformSDK_Request> join(const String &p_api, const String &p_key);
+	// Records a newly made request, so identical calls can join it.
+	void track(const String &p_key, uint64_t p_id);
+
+	// Stops tracking the request, returning any followers that were waiting on it.
+	void take_followers(uint64_t p_id, LocalVector<Ref<MetaPlatformSDK_Request>> &r_followers);
+	// Stops tracking the request, if it doesn't have any followers that are still waiting on its response.
+	void forget_if_unshared(uint64_t p_id);
+
+	_FORCE_INLINE_ bool is_empty() const { return keys_by_id.is_empty(); }
+	Dictionary get_stats() const;
+	void clear();
+};
@@ -0,0 +1,58 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/typed_array.hpp>
+
+#include "platform_sdk/meta_platform_sdk_request.h"
+
+using namespace godot;
+
+class MetaPlatformSDK_Message;
+
+// Waits on several requests at once, and emits a single signal when they're done.
+class MetaPlatformSDK_RequestGroup : public RefCounted {
+	GDCLASS(MetaPlatformSDK_RequestGroup, RefCounted);
+
+public:
+	enum Mode {
+		MODE_ALL,
+		MODE_ANY,
+	};
+
+private:
+	Mode mode = MODE_ALL;
+	TypedArray<MetaPlatformSDK_Request> requests;
+	Array messages;
+	LocalVector<Callable> continuations;
+	uint32_t finished_count = 0;
+	int32_t first_completed_index = -1;
+	bool done = false;
+
+	static Ref<MetaPlatformSDK_RequestGroup> _create(Mode p_mode, const TypedArray<MetaPlatformSDK_Request> &p_requests);
+	void _complete();
+
+protected:
+	static void _bind_methods();
+
+public:
+	static Ref<MetaPlatformSDK_RequestGroup> when_all(const TypedArray<MetaPlatformSDK_Request> &p_requests);
+	static Ref<MetaPlatformSDK_RequestGroup> when_any(const TypedArray<MetaPlatformSDK_Request> &p_requests);
+
+	void _on_request_finished(uint32_t p_index, const Ref<MetaPlatformSDK_Message> &p_message);
+
+	inline Mode get_mode() const { return mode; }
+	inline TypedArray<MetaPlatformSDK_Request> get_requests() const { return requests; }
+	inline Array get_messages() const { return messages; }
+	inline int32_t get_first_completed_index() const { return first_completed_index; }
+	inline bool is_done() const { return done; }
+
+	Ref<MetaPlatformSDK_RequestGroup> then(const Callable &p_continuation);
+	void cancel();
+
+	MetaPlatformSDK_RequestGroup();
+};
+
+VARIANT_ENUM_CAST(MetaPlatformSDK_RequestGroup::Mode);
@@ -0,0 +1,54 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/templates/local_vector.hpp>
+
+#include "platform_sdk/meta_platform_sdk_request.h"
+
+using namespace godot;
+
+// Tracks in-flight requests in a flat array sorted by request id.
+//
+// The Platform SDK hands out request ids in increasing order, so inserting is almost always an append, and
+// finished entries are left as tombstones that get compacted away in bulk, rather than allocating a node per request.
+class MetaPlatformSDKRequestTable {
+public:
+	struct Entry {
+		uint64_t id = 0;
+		uint64_t issued_usec = 0;
+		uint64_t deadline_usec = 0;
+		// Null once the request is cancelled or timed out, in which case its response is silently discarded.
+		Ref<MetaPlatformSDK_Request> request;
+		bool erased = false;
+		bool stale_reported = false;
+	};
+
+private:
+	LocalVector<Entry> entries;
+	uint32_t erased_count = 0;
+	uint32_t ignored_count = 0;
+	uint64_t next_deadline_usec = UINT64_MAX;
+
+	int64_t _find_index(uint64_t p_id) const;
+	void _compact();
+
+public:
+	void insert(uint64_t p_id, const Ref<MetaPlatformSDK_Request> &p_request, uint64_t p_issued_usec, uint64_t p_deadline_usec);
+	Entry *find(uint64_t p_id);
+	void erase(uint64_t p_id);
+
+	// Drops the request, but keeps the entry around, so its response can be discarded when it arrives.
+	void ignore(uint64_t p_id);
+	void set_deadline(uint64_t p_id, uint64_t p_deadline_usec);
+
+	// Ignores all requests whose deadline has passed, returning them in r_expired.
+	void collect_expired(uint64_t p_now_usec, LocalVector<Ref<MetaPlatformSDK_Request>> &r_expired);
+	// Returns requests older than the threshold that haven't been reported before.
+	void collect_stale(uint64_t p_now_usec, uint64_t p_threshold_usec, LocalVector<Ref<MetaPlatformSDK_Request>> &r_stale);
+	// Erases ignored entries older than the given age, whose response is unlikely to ever arrive.
+	void purge_ignored(uint64_t p_now_usec, uint64_t p_max_age_usec);
+
+	_FORCE_INLINE_ uint32_t size() const { return entries.size() - erased_count - ignored_count; }
+	_FORCE_INLINE_ bool has_expired(uint64_t p_now_usec) const { return p_now_usec >= next_deadline_usec; }
+};
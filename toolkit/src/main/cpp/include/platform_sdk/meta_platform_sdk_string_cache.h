@@ -0,0 +1,69 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+#include <godot_cpp/variant/string.hpp>
+
+#include <mutex>
+
+using namespace godot;
+
+// Caches the conversions of strings passed to and returned from the Platform SDK, which repeat a lot, for
+// example the user IDs and display names on every page of leaderboard entries, or the leaderboard name on
+// every write.
+//
+// Both caches are direct mapped: a string can only live in the slot picked by its hash, and evicts whatever
+// was there before. The Platform SDK reuses its memory once a message is freed, so strings it returns are
+// matched by their contents rather than their address.
+class MetaPlatformSDKStringCache {
+public:
+	static constexpr uint32_t DEFAULT_SIZE = 1024;
+	// Longer strings are rarely repeated, and aren't worth hashing and comparing.
+	static constexpr uint32_t MAX_LENGTH = 256;
+
+private:
+	struct ResultSlot {
+		uint32_t hash = 0;
+		// A copy of what the Platform SDK returned, to compare against.
+		LocalVector<char> bytes;
+		String string;
+	};
+
+	struct ArgumentSlot {
+		uint32_t hash = 0;
+		String string;
+		CharString utf8;
+	};
+
+	struct Stats {
+		uint64_t hits = 0;
+		uint64_t misses = 0;
+		uint64_t evictions = 0;
+		uint64_t uncached = 0;
+
+		Dictionary to_dictionary(uint32_t p_entries) const;
+	};
+
+	// Getters may be called from any thread that holds a result.
+	static std::mutex mutex;
+	static LocalVector<ResultSlot> results;
+	static LocalVector<ArgumentSlot> arguments;
+	static uint32_t size;
+	static Stats result_stats;
+	static Stats argument_stats;
+
+public:
+	// Converts a string returned by the Platform SDK, sharing the String with earlier results that had the same contents.
+	static String intern(const char *p_str);
+	// Encodes a string to pass to the Platform SDK, reusing the encoding from earlier calls with the same string.
+	static CharString utf8(const String &p_string);
+
+	// The number of slots in each cache, rounded up to a power of two, or 0 to turn caching off.
+	static void set_size(uint32_t p_size);
+	static uint32_t get_size();
+	static void clear();
+
+	static Dictionary get_stats();
+};
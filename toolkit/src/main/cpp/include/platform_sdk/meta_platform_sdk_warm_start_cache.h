@@ -0,0 +1,88 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/ref.hpp>
+#include <godot_cpp/variant/dictionary.hpp>
+
+#include "platform_sdk/meta_platform_sdk_request.h"
+
+using namespace godot;
+
+class MetaPlatformSDK_Message;
+
+// Keeps the platform data needed at startup on disk, so it can be shown before the Platform SDK responds,
+// and then brought up to date once it does.
+class MetaPlatformSDK_WarmStartCache : public RefCounted {
+	GDCLASS(MetaPlatformSDK_WarmStartCache, RefCounted);
+
+public:
+	enum Section {
+		SECTION_LOGGED_IN_USER,
+		SECTION_ENTITLEMENT,
+		SECTION_ACHIEVEMENT_DEFINITIONS,
+		SECTION_ACHIEVEMENT_PROGRESS,
+		SECTION_VIEWER_PURCHASES,
+		SECTION_MAX,
+	};
+
+private:
+	static const uint32_t FILE_MAGIC = 0x5357504d; // MPWS
+	static const uint32_t FILE_VERSION = 1;
+
+	struct Entry {
+		Variant data;
+		// Unix time of when the data last changed.
+		int64_t updated_time = 0;
+		bool has_data = false;
+		// Whether the data has been confirmed by the Platform SDK since starting.
+		bool fresh = false;
+	};
+
+	Entry sections[SECTION_MAX];
+	uint64_t user_id = 0;
+	String path = "user://meta_platform_sdk_warm_start.cache";
+
+	int32_t pending_refreshes = 0;
+	bool dirty = false;
+	// Keeps the cache alive while it's waiting on requests.
+	Ref<MetaPlatformSDK_WarmStartCache> self;
+
+	static Dictionary _object_to_dictionary(Object *p_object);
+	static bool _is_not_entitled_error(const Ref<MetaPlatformSDK_Message> &p_message);
+
+	void _update_section(Section p_section, const Variant &p_data);
+	void _section_failed(const Ref<MetaPlatformSDK_Message> &p_message, Section p_section);
+	void _section_done();
+	void _start_refresh(Section p_section, const Ref<MetaPlatformSDK_Request> &p_request, const Callable &p_on_completed);
+
+	void _on_user_received(const Ref<MetaPlatformSDK_Message> &p_message);
+	void _on_entitlement_received(const Ref<MetaPlatformSDK_Message> &p_message);
+	void _on_first_page_received(const Ref<MetaPlatformSDK_Message> &p_message, Section p_section);
+	void _on_pages_completed(const Dictionary &p_columns, Section p_section);
+	void _on_request_failed(Section p_section);
+
+protected:
+	static void _bind_methods();
+	String _to_string() const;
+
+public:
+	void set_path(const String &p_path);
+	inline String get_path() const { return path; }
+
+	bool load();
+	Error save();
+	void clear();
+
+	void refresh();
+	inline bool is_refreshing() const { return pending_refreshes > 0; }
+
+	Variant get_data(Section p_section) const;
+	bool has_data(Section p_section) const;
+	bool is_fresh(Section p_section) const;
+	int64_t get_updated_time(Section p_section) const;
+
+	MetaPlatformSDK_WarmStartCache();
+};
+
+VARIANT_ENUM_CAST(MetaPlatformSDK_WarmStartCache::Section);
@@ -0,0 +1,108 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/classes/node.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/hash_set.hpp>
+
+using namespace godot;
+
+class MetaPlatformSDK_Message;
+class MetaPlatformSDK_Request;
+
+// Holds back achievement and leaderboard writes, merging them until the next flush.
+class MetaPlatformSDK_WriteQueue : public Node {
+	GDCLASS(MetaPlatformSDK_WriteQueue, Node);
+
+	enum WriteType {
+		WRITE_COUNT,
+		WRITE_FIELDS,
+		WRITE_SCORE,
+	};
+
+	struct PendingCount {
+		uint64_t count = 0;
+		// The number of times this write has already failed.
+		uint32_t retries = 0;
+	};
+
+	struct PendingFields {
+		String fields;
+		uint32_t retries = 0;
+	};
+
+	struct PendingScore {
+		int64_t score = 0;
+		PackedByteArray extra_data;
+		bool force_update = false;
+		uint32_t retries = 0;
+	};
+
+	// A merged write that has been sent, kept until it completes in case it needs to be queued again.
+	struct SentWrite {
+		WriteType type = WRITE_COUNT;
+		String name;
+		PendingCount count;
+		PendingFields fields;
+		PendingScore score;
+	};
+
+	HashMap<String, PendingCount> pending_counts;
+	HashMap<String, PendingFields> pending_fields;
+	HashMap<String, PendingScore> pending_scores;
+	HashSet<String> lower_score_is_better;
+
+	HashMap<uint64_t, SentWrite> sent_writes;
+	uint64_t next_sent_write_id = 1;
+
+	double flush_interval = 5.0;
+	uint64_t last_flush_usec = 0;
+	int32_t max_retries = 3;
+
+	uint64_t writes_queued = 0;
+	uint64_t writes_merged = 0;
+	uint64_t writes_retried = 0;
+	uint64_t requests_issued = 0;
+	uint64_t requests_failed = 0;
+
+	static String _merge_fields(const String &p_a, const String &p_b);
+	_FORCE_INLINE_ bool _is_better_score(const String &p_leaderboard_name, int64_t p_score, int64_t p_than) const {
+		return lower_score_is_better.has(p_leaderboard_name) ? p_score < p_than : p_score > p_than;
+	}
+
+	bool _queue_count(const String &p_name, const PendingCount &p_count);
+	bool _queue_fields(const String &p_name, const PendingFields &p_fields);
+	bool _queue_score(const String &p_leaderboard_name, const PendingScore &p_score);
+	void _requeue_score(const String &p_leaderboard_name, const PendingScore &p_score);
+
+	bool _send(const Ref<MetaPlatformSDK_Request> &p_request, const SentWrite &p_write);
+	void _write_failed(const SentWrite &p_write, const Ref<MetaPlatformSDK_Message> &p_message);
+	void _on_write_completed(const Ref<MetaPlatformSDK_Message> &p_message, uint64_t p_write_id);
+	void _on_write_timed_out(uint64_t p_write_id);
+
+protected:
+	static void _bind_methods();
+	void _notification(int p_what);
+
+public:
+	void set_flush_interval(double p_seconds);
+	inline double get_flush_interval() const { return flush_interval; }
+
+	void set_max_retries(int32_t p_max_retries);
+	inline int32_t get_max_retries() const { return max_retries; }
+
+	void set_lower_score_is_better(const String &p_leaderboard_name, bool p_enable);
+	bool is_lower_score_is_better(const String &p_leaderboard_name) const;
+
+	void achievements_add_count(const String &p_name, uint64_t p_count);
+	void achievements_add_fields(const String &p_name, const String &p_fields);
+	void leaderboard_write_entry(const String &p_leaderboard_name, int64_t p_score, const PackedByteArray &p_extra_data, bool p_force_update);
+
+	int32_t get_pending_count() const;
+	int32_t flush();
+	void clear();
+	Dictionary get_stats() const;
+
+	MetaPlatformSDK_WriteQueue();
+};
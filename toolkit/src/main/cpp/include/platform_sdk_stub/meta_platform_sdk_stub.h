@@ -0,0 +1,159 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#ifdef META_PLATFORM_SDK_STUB
+#include <OVR_Platform.h>
+
+#include <godot_cpp/classes/object.hpp>
+#include <godot_cpp/templates/hash_map.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+#include <mutex>
+
+using namespace godot;
+
+// Stands in for any OVR handle. Fields are looked up by the name of the OVR accessor, without the
+// class prefix or a leading "Get", for example "DisplayName" for ovr_User_GetDisplayName().
+// Arrays are either an Array, or a Dictionary with the elements under "Elements" and other fields
+// (like "HasNextPage") alongside.
+struct MetaPlatformSDKStubObject {
+	Variant value;
+
+	// The OVR API hands out pointers, so these need to live as long as the object.
+	HashMap<String, CharString> strings;
+	HashMap<String, PackedByteArray> bytes;
+	HashMap<String, MetaPlatformSDKStubObject *> children;
+	LocalVector<MetaPlatformSDKStubObject *> elements;
+	bool has_elements = false;
+
+	Variant get_field(const char *p_field) const;
+	void set_field(const String &p_field, const Variant &p_value);
+	void reset(const Variant &p_value = Variant());
+
+	// With a null field, these return the value itself.
+	const char *get_string(const char *p_field);
+	const void *get_bytes(const char *p_field);
+	MetaPlatformSDKStubObject *get_child(const char *p_field);
+	uint64_t get_size();
+	MetaPlatformSDKStubObject *get_element(uint64_t p_index);
+
+	// Accessors on a null handle behave like they were called on an empty object.
+	static MetaPlatformSDKStubObject *from_handle(const void *p_handle);
+
+	MetaPlatformSDKStubObject(const Variant &p_value = Variant()) :
+			value(p_value) {}
+	~MetaPlatformSDKStubObject();
+};
+
+// Stands in for ovrMessageHandle.
+struct MetaPlatformSDKStubMessage {
+	ovrMessageType type = ovrMessage_Unknown;
+	ovrRequest request_id = 0;
+	bool is_error = false;
+	uint64_t deliver_usec = 0;
+	uint64_t sequence = 0;
+	MetaPlatformSDKStubObject payload;
+	MetaPlatformSDKStubObject error;
+};
+
+// An in-process stand-in for the Platform SDK, so the bindings can run (and be profiled) on desktop.
+// Requests are answered with scripted responses after a configurable latency. Build with
+// 'scons platform_sdk_stub=yes', then script it from GDScript through the MetaPlatformSDK_Stub singleton:
+//
+//   MetaPlatformSDK_Stub.latency = 0.05
+//   MetaPlatformSDK_Stub.set_response(MetaPlatformSDK.MESSAGE_USER_GET, { "data": { "ID": 1, "DisplayName": "Tester" } })
+//   MetaPlatformSDK_Stub.set_notification_load(MetaPlatformSDK.MESSAGE_NOTIFICATION_ASSET_FILE_DOWNLOAD_UPDATE, 500.0)
+//
+// Responses may also have an "error" (with "Code" and "Message" fields), and their own "latency" and "jitter".
+class MetaPlatformSDK_Stub : public Object {
+	GDCLASS(MetaPlatformSDK_Stub, Object);
+
+	static MetaPlatformSDK_Stub *singleton;
+
+	struct Response {
+		Variant data;
+		Dictionary error;
+		double latency = -1.0;
+		double jitter = -1.0;
+	};
+
+	struct NotificationLoad {
+		ovrMessageType type = ovrMessage_Unknown;
+		double rate = 0.0;
+		Variant data;
+		double carry = 0.0;
+	};
+
+	// The message thread may pop messages while the main thread makes requests.
+	mutable std::mutex mutex;
+
+	bool initialized = false;
+	double latency = 0.0;
+	double jitter = 0.0;
+	uint64_t seed = 0x853c49e6748fea9bULL;
+	uint64_t rng_state = 0x853c49e6748fea9bULL;
+
+	HashMap<int32_t, Response> responses;
+	LocalVector<NotificationLoad> notification_loads;
+	uint64_t last_load_usec = 0;
+
+	// A min-heap by delivery time.
+	LocalVector<MetaPlatformSDKStubMessage *> pending;
+	uint64_t next_sequence = 0;
+	ovrRequest last_request_id = 0;
+
+	MetaPlatformSDKStubObject globals;
+	MetaPlatformSDKStubObject empty_object;
+
+	uint64_t requests_made = 0;
+	uint64_t notifications_made = 0;
+	uint64_t messages_popped = 0;
+	uint64_t messages_freed = 0;
+
+	static uint64_t _get_ticks_usec();
+	double _randf();
+	uint64_t _get_delay_usec(double p_latency, double p_jitter);
+	void _push(MetaPlatformSDKStubMessage *p_message);
+	MetaPlatformSDKStubMessage *_make_message(ovrMessageType p_type, const Variant &p_data, const Dictionary &p_error);
+	void _generate_load(uint64_t p_now_usec);
+
+protected:
+	static void _bind_methods();
+
+public:
+	static MetaPlatformSDK_Stub *get_singleton();
+
+	// Used by the stand-in OVR functions.
+	ovrRequest _request(ovrMessageType p_type);
+	ovrMessageHandle _pop_message();
+	void _free_message(ovrMessageHandle p_message);
+	_FORCE_INLINE_ bool _is_initialized() const { return initialized; }
+	_FORCE_INLINE_ MetaPlatformSDKStubObject *_get_globals() { return &globals; }
+	_FORCE_INLINE_ MetaPlatformSDKStubObject *_get_empty_object() { return &empty_object; }
+
+	ovrPlatformInitializeResult initialize(const String &p_app_id);
+	ovrRequest initialize_async(const String &p_app_id);
+
+	void set_latency(double p_seconds);
+	double get_latency() const;
+	void set_jitter(double p_seconds);
+	double get_jitter() const;
+	void set_seed(int64_t p_seed);
+	int64_t get_seed() const;
+
+	void set_response(int32_t p_message_type, const Dictionary &p_response);
+	void clear_responses();
+	void set_global(const String &p_field, const Variant &p_value);
+
+	void push_notification(int32_t p_message_type, const Variant &p_data, int32_t p_count);
+	void set_notification_load(int32_t p_message_type, double p_rate, const Variant &p_data);
+
+	int32_t get_pending_message_count() const;
+	Dictionary get_stats() const;
+	void reset();
+
+	MetaPlatformSDK_Stub();
+	~MetaPlatformSDK_Stub();
+};
+#endif // META_PLATFORM_SDK_STUB
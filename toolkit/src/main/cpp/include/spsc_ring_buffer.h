@@ -0,0 +1,66 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#pragma once
+
+#include <godot_cpp/core/error_macros.hpp>
+#include <godot_cpp/templates/local_vector.hpp>
+
+#include <atomic>
+#include <utility>
+
+using namespace godot;
+
+// A lock-free ring buffer for passing values from exactly one producer thread to exactly one consumer thread.
+template <typename T>
+class SPSCRingBuffer {
+	LocalVector<T> buffer;
+	uint32_t mask = 0;
+
+	// Keep the indices on separate cache lines, so the producer and consumer don't contend.
+	uint8_t _pad0[64];
+	std::atomic<uint32_t> read_pos = { 0 };
+	uint8_t _pad1[64];
+	std::atomic<uint32_t> write_pos = { 0 };
+	uint8_t _pad2[64];
+
+public:
+	// Must not be called while either thread is using the buffer.
+	void resize(uint32_t p_capacity) {
+		ERR_FAIL_COND_MSG(p_capacity == 0 || (p_capacity & (p_capacity - 1)) != 0, "SPSCRingBuffer capacity must be a power of two.");
+		buffer.clear();
+		buffer.resize(p_capacity);
+		mask = p_capacity - 1;
+		read_pos.store(0, std::memory_order_relaxed);
+		write_pos.store(0, std::memory_order_relaxed);
+	}
+
+	_FORCE_INLINE_ uint32_t capacity() const { return mask + 1; }
+
+	// Producer only.
+	_FORCE_INLINE_ bool is_full() const {
+		return write_pos.load(std::memory_order_relaxed) - read_pos.load(std::memory_order_acquire) > mask;
+	}
+
+	// Producer only.
+	bool push(T &&p_value) {
+		uint32_t write = write_pos.load(std::memory_order_relaxed);
+		if (write - read_pos.load(std::memory_order_acquire) > mask) {
+			return false;
+		}
+		buffer[write & mask] = std::move(p_value);
+		write_pos.store(write + 1, std::memory_order_release);
+		return true;
+	}
+
+	// Consumer only.
+	bool pop(T &r_value) {
+		uint32_t read = read_pos.load(std::memory_order_relaxed);
+		if (read == write_pos.load(std::memory_order_acquire)) {
+			return false;
+		}
+		r_value = std::move(buffer[read & mask]);
+		buffer[read & mask] = T();
+		read_pos.store(read + 1, std::memory_order_release);
+		return true;
+	}
+};
@@ -3,6 +3,11 @@
 #pragma once
 
 #include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/packed_byte_array.hpp>
+
+#include <cstring>
+
+using namespace godot;
 
 struct CharStringList {
 	LocalVector<CharString> list;
@@ -17,3 +22,12 @@ struct CharStringList {
 		}
 	}
 };
+
+inline PackedByteArray bytes_to_packed_byte_array(const void *p_data, size_t p_size) {
+	PackedByteArray result;
+	if (p_data && p_size > 0) {
+		result.resize(p_size);
+		memcpy(result.ptrw(), p_data, p_size);
+	}
+	return result;
+}
@@ -0,0 +1,94 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "meta_toolkit_performance_settings.h"
+
+#include <godot_cpp/classes/config_file.hpp>
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/open_xr_interface.hpp>
+#include <godot_cpp/classes/xr_server.hpp>
+
+MetaToolkitPerformanceSettings *MetaToolkitPerformanceSettings::singleton = nullptr;
+
+void MetaToolkitPerformanceSettings::initialize() {
+	if (Engine::get_singleton()->is_editor_hint() || !FileAccess::file_exists(SETTINGS_PATH)) {
+		return;
+	}
+
+	Ref<ConfigFile> config;
+	config.instantiate();
+	Error err = config->load(SETTINGS_PATH);
+	ERR_FAIL_COND_MSG(err != OK, vformat("MetaToolkit: Unable to load the performance settings from %s", SETTINGS_PATH));
+
+	singleton = memnew(MetaToolkitPerformanceSettings);
+	singleton->display_refresh_rate = config->get_value(SETTINGS_SECTION, "display_refresh_rate", 0.0);
+	singleton->cpu_level = config->get_value(SETTINGS_SECTION, "cpu_level", -1);
+	singleton->gpu_level = config->get_value(SETTINGS_SECTION, "gpu_level", -1);
+	singleton->foveation_level = config->get_value(SETTINGS_SECTION, "foveation_level", -1);
+	singleton->foveation_dynamic = config->get_value(SETTINGS_SECTION, "foveation_dynamic", false);
+
+	// The OpenXR interface is normally added before extensions are initialized, but don't count on it.
+	if (!singleton->_connect_to_interface()) {
+		XRServer::get_singleton()->connect("interface_added", callable_mp(singleton, &MetaToolkitPerformanceSettings::_on_interface_added));
+	}
+}
+
+void MetaToolkitPerformanceSettings::finalize() {
+	if (singleton != nullptr) {
+		memdelete(singleton);
+		singleton = nullptr;
+	}
+}
+
+bool MetaToolkitPerformanceSettings::_connect_to_interface() {
+	Ref<XRInterface> xr_interface = XRServer::get_singleton()->find_interface("OpenXR");
+	OpenXRInterface *openxr_interface = Object::cast_to<OpenXRInterface>(xr_interface.ptr());
+	if (openxr_interface == nullptr) {
+		return false;
+	}
+
+	// Foveation is set up along with the swapchains, so it's best applied before the session starts.
+	if (foveation_level >= 0) {
+		openxr_interface->set_foveation_level(foveation_level);
+		openxr_interface->set_foveation_dynamic(foveation_dynamic);
+	}
+	openxr_interface->connect("session_begun", callable_mp(this, &MetaToolkitPerformanceSettings::_on_session_begun));
+	return true;
+}
+
+void MetaToolkitPerformanceSettings::_on_interface_added(const StringName &p_interface_name) {
+	if (p_interface_name == StringName("OpenXR") && _connect_to_interface()) {
+		XRServer::get_singleton()->disconnect("interface_added", callable_mp(this, &MetaToolkitPerformanceSettings::_on_interface_added));
+	}
+}
+
+void MetaToolkitPerformanceSettings::_on_session_begun() {
+	Ref<XRInterface> xr_interface = XRServer::get_singleton()->find_interface("OpenXR");
+	OpenXRInterface *openxr_interface = Object::cast_to<OpenXRInterface>(xr_interface.ptr());
+	ERR_FAIL_NULL(openxr_interface);
+
+	if (display_refresh_rate > 0.0) {
+		// Not every headset supports every rate, so fall back on the highest one that doesn't go over.
+		float refresh_rate = 0.0;
+		Array available_rates = openxr_interface->get_available_display_refresh_rates();
+		for (int i = 0; i < available_rates.size(); i++) {
+			float available_rate = available_rates[i];
+			if (available_rate <= display_refresh_rate + 0.5 && available_rate > refresh_rate) {
+				refresh_rate = available_rate;
+			}
+		}
+
+		if (refresh_rate > 0.0) {
+			openxr_interface->set_display_refresh_rate(refresh_rate);
+		} else {
+			WARN_PRINT(vformat("MetaToolkit: Display refresh rate %s Hz isn't available on this headset", display_refresh_rate));
+		}
+	}
+
+	if (cpu_level >= 0) {
+		openxr_interface->set_cpu_level((OpenXRInterface::PerfSettingsLevel)cpu_level);
+	}
+	if (gpu_level >= 0) {
+		openxr_interface->set_gpu_level((OpenXRInterface::PerfSettingsLevel)gpu_level);
+	}
+}
@@ -12,23 +12,58 @@
 
 #include <godot_cpp/classes/engine.hpp>
 #include <godot_cpp/classes/main_loop.hpp>
+#include <godot_cpp/classes/performance.hpp>
+#include <godot_cpp/classes/time.hpp>
 #include <godot_cpp/core/class_db.hpp>
 #include <godot_cpp/templates/local_vector.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
 
+#include "platform_sdk/meta_platform_sdk_challenge_entry.h"
 #include "platform_sdk/meta_platform_sdk_http_transfer_update.h"
 #include "platform_sdk/meta_platform_sdk_message.h"
+#include "platform_sdk/meta_platform_sdk_object_pool.h"
 #include "platform_sdk/meta_platform_sdk_packet.h"
+#include "platform_sdk/meta_platform_sdk_string_cache.h"
+#include "util.h"
 
-#ifdef ANDROID_ENABLED
+// Only generated when the Leaderboard module is selected with 'platform_sdk_modules'.
+#ifdef META_PLATFORM_SDK_MODULE_LEADERBOARD
+#include "platform_sdk/meta_platform_sdk_leaderboard_entry.h"
+#endif
+
+#ifdef META_PLATFORM_SDK_ENABLED
 #include <OVR_Platform.h>
+
+#ifdef ANDROID_ENABLED
 #include <jni.h>
 
 static JNIEnv *jni_env = nullptr;
 static jobject jactivity = nullptr;
+#endif // ANDROID_ENABLED
+
+#ifdef META_PLATFORM_SDK_STUB
+#include "platform_sdk_stub/meta_platform_sdk_stub.h"
+#endif // META_PLATFORM_SDK_STUB
+
+// How often to look for stale requests.
+static const uint64_t REQUEST_SWEEP_INTERVAL_USEC = 1000000;
+// How long to wait for the response to a cancelled or timed out request, before we forget about it.
+static const uint64_t IGNORED_REQUEST_LIFETIME_USEC = 600000000;
 #endif
 
+// The gauges we show in the Monitors tab.
+enum {
+	MONITOR_PUMP_TIME,
+	MONITOR_QUEUE_DEPTH,
+	MONITOR_REQUESTS_IN_FLIGHT,
+};
+
 MetaPlatformSDK::PlatformInitializeResult MetaPlatformSDK::initialize_platform(const String &p_app_id, const Dictionary &p_options) {
-#ifdef ANDROID_ENABLED
+#if defined(META_PLATFORM_SDK_STUB)
+	ovrPlatformInitializeResult result = MetaPlatformSDKStub::get_singleton()->initialize(p_app_id);
+	_initialize_platform();
+	return (PlatformInitializeResult)result;
+#elif defined(ANDROID_ENABLED)
 	ERR_FAIL_NULL_V(jni_env, PLATFORM_INITIALIZE_UNINITIALIZED);
 	ERR_FAIL_NULL_V(jactivity, PLATFORM_INITIALIZE_UNINITIALIZED);
 
@@ -64,12 +99,16 @@ MetaPlatformSDK::PlatformInitializeResult MetaPlatformSDK::initialize_platform(c
 }
 
 Ref<MetaPlatformSDK_Request> MetaPlatformSDK::initialize_platform_async(const String &p_app_id) {
-#ifdef ANDROID_ENABLED
+#if defined(META_PLATFORM_SDK_ENABLED)
+#if defined(META_PLATFORM_SDK_STUB)
+	Ref<MetaPlatformSDK_Request> request = MetaPlatformSDK::_create_request(MetaPlatformSDKStub::get_singleton()->initialize_async(p_app_id));
+#else
 	ERR_FAIL_NULL_V(jni_env, Ref<MetaPlatformSDK_Request>());
 	ERR_FAIL_NULL_V(jactivity, Ref<MetaPlatformSDK_Request>());
 
 	Ref<MetaPlatformSDK_Request> request = MetaPlatformSDK::_create_request(ovr_PlatformInitializeAndroidAsynchronous(p_app_id.ascii().ptr(), jactivity, jni_env));
-	request->connect("completed", callable_mp(this, &MetaPlatformSDK::_initialize_platform_async));
+#endif
+	request->then(callable_mp(this, &MetaPlatformSDK::_initialize_platform_async));
 
 	// Need to initialize so that async requests will be handled.
 	_initialize_platform();
@@ -81,6 +120,7 @@ Ref<MetaPlatformSDK_Request> MetaPlatformSDK::initialize_platform_async(const St
 #endif
 }
 
+#ifdef META_PLATFORM_SDK_ENABLED
 #ifdef ANDROID_ENABLED
 extern "C" {
 JNIEXPORT void JNICALL Java_com_meta_w4_godot_toolkit_GodotMetaToolkit_initPlatformSDK(JNIEnv *p_env, jobject p_obj, jobject p_activity) {
@@ -88,6 +128,7 @@ JNIEXPORT void JNICALL Java_com_meta_w4_godot_toolkit_GodotMetaToolkit_initPlatf
 	jactivity = reinterpret_cast<jobject>(jni_env->NewGlobalRef(p_activity));
 }
 }
+#endif // ANDROID_ENABLED
 
 void MetaPlatformSDK::_initialize_platform() {
 	if (!_platform_initialized) {
@@ -95,6 +136,14 @@ void MetaPlatformSDK::_initialize_platform() {
 
 		MainLoop *main_loop = Engine::get_singleton()->get_main_loop();
 		main_loop->connect("process_frame", callable_mp(this, &MetaPlatformSDK::_process_messages));
+
+		if (message_pump_threaded) {
+			message_thread.start();
+		}
+
+		if (performance_monitors_enabled) {
+			_add_performance_monitors();
+		}
 	}
 }
 
@@ -107,49 +156,785 @@ void MetaPlatformSDK::_initialize_platform_async(const Ref<MetaPlatformSDK_Messa
 	}
 }
 
-Ref<MetaPlatformSDK_Request> MetaPlatformSDK::_create_request(ovrRequest p_request) {
+Ref<MetaPlatformSDK_Request> MetaPlatformSDK::_create_request(ovrRequest p_request, const String &p_coalesce_key) {
 	Ref<MetaPlatformSDK_Request> request;
 	request.instantiate();
 	request->id = p_request;
-	requests[p_request] = request;
+
+	uint64_t now_usec = Time::get_singleton()->get_ticks_usec();
+	uint64_t deadline_usec = request_default_timeout > 0.0 ? now_usec + (uint64_t)(request_default_timeout * 1000000.0) : 0;
+	requests.insert(p_request, request, now_usec, deadline_usec);
+
+	if (!p_coalesce_key.is_empty()) {
+		request_coalescer.track(p_coalesce_key, p_request);
+	}
+
 	return request;
 }
 
+Ref<MetaPlatformSDK_Request> MetaPlatformSDK::_join_coalesced_request(const String &p_api, const Array &p_args, String &r_key) {
+	r_key = p_args.is_empty() ? p_api : p_api + UtilityFunctions::var_to_str(p_args);
+	return request_coalescer.join(p_api, r_key);
+}
+
+void MetaPlatformSDK::_cancel_request(MetaPlatformSDK_Request *p_request) {
+	if (p_request->id == 0) {
+		_release_coalesced_request(p_request);
+		return;
+	}
+	requests.ignore(p_request->id);
+	if (!request_coalescer.is_empty()) {
+		request_coalescer.forget_if_unshared(p_request->id);
+	}
+}
+
+void MetaPlatformSDK::_set_request_timeout(MetaPlatformSDK_Request *p_request, double p_seconds) {
+	uint64_t deadline_usec = p_seconds > 0.0 ? Time::get_singleton()->get_ticks_usec() + (uint64_t)(p_seconds * 1000000.0) : 0;
+	if (p_request->id != 0) {
+		requests.set_deadline(p_request->id, deadline_usec);
+		return;
+	}
+
+	// A coalesced request still times out along with the request it shares, but it can give up sooner.
+	for (uint32_t i = 0; i < coalesced_timeouts.size(); i++) {
+		if (coalesced_timeouts[i].request.ptr() == p_request) {
+			if (deadline_usec == 0) {
+				coalesced_timeouts.remove_at_unordered(i);
+			} else {
+				coalesced_timeouts[i].deadline_usec = deadline_usec;
+			}
+			return;
+		}
+	}
+	if (deadline_usec != 0) {
+		coalesced_timeouts.push_back({ Ref<MetaPlatformSDK_Request>(p_request), deadline_usec });
+	}
+}
+
+void MetaPlatformSDK::_release_coalesced_request(MetaPlatformSDK_Request *p_request) {
+	// Once the shared request and all of its followers have given up, identical calls shouldn't join it anymore.
+	MetaPlatformSDKRequestTable::Entry *entry = requests.find(p_request->shared_id);
+	if (entry == nullptr || entry->request.is_null()) {
+		request_coalescer.forget_if_unshared(p_request->shared_id);
+	}
+}
+
+void MetaPlatformSDK::_sweep_requests(uint64_t p_now_usec) {
+	for (uint32_t i = 0; i < coalesced_timeouts.size();) {
+		if (coalesced_timeouts[i].request->get_status() != MetaPlatformSDK_Request::STATUS_PENDING) {
+			coalesced_timeouts.remove_at_unordered(i);
+			continue;
+		}
+		if (p_now_usec < coalesced_timeouts[i].deadline_usec) {
+			i++;
+			continue;
+		}
+		// Taken out first, since the handlers may set more timeouts.
+		Ref<MetaPlatformSDK_Request> request = coalesced_timeouts[i].request;
+		coalesced_timeouts.remove_at_unordered(i);
+		request->_finish(MetaPlatformSDK_Request::STATUS_TIMED_OUT, Ref<MetaPlatformSDK_Message>());
+		_release_coalesced_request(request.ptr());
+	}
+
+	if (requests.has_expired(p_now_usec)) {
+		LocalVector<Ref<MetaPlatformSDK_Request>> expired;
+		requests.collect_expired(p_now_usec, expired);
+		for (const Ref<MetaPlatformSDK_Request> &request : expired) {
+			LocalVector<Ref<MetaPlatformSDK_Request>> followers;
+			if (!request_coalescer.is_empty()) {
+				request_coalescer.take_followers(request->id, followers);
+			}
+
+			request->_finish(MetaPlatformSDK_Request::STATUS_TIMED_OUT, Ref<MetaPlatformSDK_Message>());
+			for (const Ref<MetaPlatformSDK_Request> &follower : followers) {
+				follower->_finish(MetaPlatformSDK_Request::STATUS_TIMED_OUT, Ref<MetaPlatformSDK_Message>());
+			}
+		}
+	}
+
+	if (p_now_usec - _last_request_sweep_usec < REQUEST_SWEEP_INTERVAL_USEC) {
+		return;
+	}
+	_last_request_sweep_usec = p_now_usec;
+
+	if (request_stale_threshold > 0.0) {
+		LocalVector<Ref<MetaPlatformSDK_Request>> stale;
+		requests.collect_stale(p_now_usec, (uint64_t)(request_stale_threshold * 1000000.0), stale);
+		for (const Ref<MetaPlatformSDK_Request> &request : stale) {
+			emit_signal("request_stale", request);
+		}
+	}
+
+	requests.purge_ignored(p_now_usec, IGNORED_REQUEST_LIFETIME_USEC);
+}
+
 void MetaPlatformSDK::_process_messages() {
-	while (ovrMessageHandle message_handle = ovr_PopMessage()) {
-		Ref<MetaPlatformSDK_Message> message = MetaPlatformSDK_Message::_create_with_ovr_handle(message_handle);
-		if (message->is_notification()) {
-			emit_signal("notification_received", message);
-		} else {
-			ovrRequest request_id = (ovrRequest)message->get_request_id();
-			if (request_id != 0) {
-				Ref<MetaPlatformSDK_Request> *request = requests.getptr(request_id);
-				if (request) {
-					(*request)->emit_signal("completed", message);
-					requests.erase(request_id);
-				} else {
-					ERR_PRINT(vformat("MetaPlatformSDK: Received message %s with unknown request id %s", ovrMessageType_ToString((ovrMessageType)message->get_type()), request_id));
+	if (message_pump_automatic) {
+		pump_messages();
+	}
+}
+
+Ref<MetaPlatformSDK_Message> MetaPlatformSDK::_get_pending_message(const MetaPlatformSDKPendingMessage &p_pending) {
+	if (p_pending.message.is_valid()) {
+		// Already created and decoded by the message thread.
+		return p_pending.message;
+	}
+	return MetaPlatformSDK_Message::_create_with_ovr_handle(p_pending.handle, (MessageType)p_pending.type, Variant());
+}
+
+void MetaPlatformSDK::_dispatch_message(MetaPlatformSDKPendingMessage &p_pending) {
+	if (p_pending.is_notification) {
+		if (p_pending.type == ovrMessage_Notification_HTTP_Transfer && !http_transfer_sinks.is_empty() && _dispatch_http_transfer(p_pending.handle)) {
+			return;
+		}
+
+		// Get the filter id while we still have the handle, since the message may be detached.
+		int32_t index = _get_notification_index(p_pending.type);
+		bool has_handlers = index >= 0 && !notification_handlers[index].is_empty();
+		uint64_t filter_id = 0;
+		bool has_filter_id = has_handlers && _is_notification_filterable(p_pending.type) && _get_notification_filter_id(p_pending.handle, p_pending.type, filter_id);
+
+		Ref<MetaPlatformSDK_Message> message = _get_pending_message(p_pending);
+		if (detach_messages && !message->_has_next_page()) {
+			message->detach();
+		}
+		if (has_handlers) {
+			_call_notification_handlers(index, has_filter_id, filter_id, message);
+		}
+		emit_signal("notification_received", message);
+		return;
+	}
+
+	ovrRequest request_id = p_pending.request_id;
+	MetaPlatformSDKRequestTable::Entry *entry = request_id != 0 ? requests.find(request_id) : nullptr;
+	if (entry == nullptr) {
+		if (request_id != 0) {
+			ERR_PRINT(vformat("MetaPlatformSDK: Received message %s with unknown request id %s", ovrMessageType_ToString(p_pending.type), request_id));
+		}
+		p_pending.free();
+		return;
+	}
+
+	// Take it out of the table first, since the handlers may make new requests.
+	Ref<MetaPlatformSDK_Request> request = entry->request;
+	uint64_t issued_usec = entry->issued_usec;
+	requests.erase(request_id);
+
+	LocalVector<Ref<MetaPlatformSDK_Request>> followers;
+	if (!request_coalescer.is_empty()) {
+		request_coalescer.take_followers(request_id, followers);
+	}
+
+	if (request.is_null() && followers.is_empty()) {
+		// The request was cancelled or timed out, so nobody wants the response anymore.
+		p_pending.free();
+		return;
+	}
+
+	if (request_latencies.record(p_pending.type, Time::get_singleton()->get_ticks_usec() - issued_usec) && performance_monitors_enabled) {
+		_add_request_latency_monitors(p_pending.type);
+	}
+
+	// Coalesced requests all share the same message.
+	Ref<MetaPlatformSDK_Message> message = _get_pending_message(p_pending);
+	// Paginated results keep their native handle, which is needed to request the next page.
+	if (detach_messages && !message->_has_next_page()) {
+		message->detach();
+	}
+	if (request.is_valid()) {
+		request->_finish(MetaPlatformSDK_Request::STATUS_COMPLETED, message);
+	}
+	for (const Ref<MetaPlatformSDK_Request> &follower : followers) {
+		follower->_finish(MetaPlatformSDK_Request::STATUS_COMPLETED, message);
+	}
+}
+
+void MetaPlatformSDK::_coalesce_pending_messages() {
+	struct CoalesceKey {
+		ovrMessageType type;
+		uint64_t key;
+	};
+	// There's only ever a handful of downloads or sessions at once, so a linear search is fine.
+	LocalVector<CoalesceKey> seen;
+
+	// Walk backwards, so the newest message for each key is kept, and it stays in its place in the queue.
+	uint32_t write = pending_messages.size();
+	for (uint32_t i = pending_messages.size(); i > pending_messages_head; i--) {
+		MetaPlatformSDKPendingMessage &pending = pending_messages[i - 1];
+
+		uint64_t key = 0;
+		if (pending.is_notification && _get_notification_coalesce_key(pending.handle, pending.type, key)) {
+			bool newer = false;
+			for (const CoalesceKey &other : seen) {
+				if (other.type == pending.type && other.key == key) {
+					newer = true;
+					break;
 				}
 			}
+
+			if (newer) {
+				pending.free();
+				coalesced_notifications[pending.type] += 1;
+				continue;
+			}
+			seen.push_back({ pending.type, key });
+		}
+
+		write--;
+		if (write != i - 1) {
+			pending_messages[write] = pending;
+		}
+	}
+
+	if (write == pending_messages_head) {
+		return;
+	}
+	uint32_t kept = pending_messages.size() - write;
+	for (uint32_t i = 0; i < kept; i++) {
+		pending_messages[pending_messages_head + i] = pending_messages[write + i];
+	}
+	pending_messages.resize(pending_messages_head + kept);
+}
+
+void MetaPlatformSDK::_call_notification_handlers(int32_t p_index, bool p_has_filter_id, uint64_t p_filter_id, const Ref<MetaPlatformSDK_Message> &p_message) {
+	LocalVector<NotificationHandler> &handlers = notification_handlers[p_index];
+
+	// Handlers can be added or removed while we're calling them, so removed ones are only cleared here,
+	// and erased afterwards.
+	_dispatching_notification_index = p_index;
+	for (uint32_t i = 0; i < handlers.size(); i++) {
+		if (handlers[i].has_filter && (!p_has_filter_id || handlers[i].filter_id != p_filter_id)) {
+			continue;
+		}
+
+		// Copied, because calling it may add another handler, and reallocate the list.
+		Callable callable = handlers[i].callable;
+		if (!callable.is_valid()) {
+			// The object it was bound to has been freed.
+			handlers[i].callable = Callable();
+			_notification_handlers_dirty = true;
+			continue;
+		}
+		callable.call(p_message);
+	}
+	_dispatching_notification_index = -1;
+
+	if (_notification_handlers_dirty) {
+		_notification_handlers_dirty = false;
+		for (uint32_t i = handlers.size(); i > 0; i--) {
+			if (handlers[i - 1].callable.is_null()) {
+				handlers.remove_at(i - 1);
+			}
+		}
+	}
+}
+
+bool MetaPlatformSDK::_dispatch_http_transfer(ovrMessageHandle p_message) {
+	if (ovr_Message_IsError(p_message)) {
+		// Errors don't say which transfer they belong to, so we can only fail a sink when there's just the one.
+		// The rest are left to their idle timeout. Either way, the notification handlers get the error too.
+		if (http_transfer_sinks.size() == 1) {
+			uint64_t transfer_id = http_transfer_sinks.begin()->key;
+			Ref<MetaPlatformSDK_HttpTransferSink> sink = http_transfer_sinks.begin()->value;
+			http_transfer_sinks.erase(transfer_id);
+			sink->_fail(String::utf8(ovr_Error_GetMessage(ovr_Message_GetError(p_message))));
+		}
+		return false;
+	}
+
+	ovrHttpTransferUpdateHandle update = ovr_Message_GetHttpTransferUpdate(p_message);
+	uint64_t transfer_id = ovr_HttpTransferUpdate_GetID(update);
+
+	Ref<MetaPlatformSDK_HttpTransferSink> *sink_ptr = http_transfer_sinks.getptr(transfer_id);
+	if (sink_ptr == nullptr) {
+		return false;
+	}
+
+	Ref<MetaPlatformSDK_HttpTransferSink> sink = *sink_ptr;
+	sink->_append(ovr_HttpTransferUpdate_GetBytes(update), ovr_HttpTransferUpdate_GetSize(update));
+	bool completed = ovr_HttpTransferUpdate_IsCompleted(update);
+	ovr_FreeMessage(p_message);
+
+	if (completed) {
+		http_transfer_sinks.erase(transfer_id);
+		sink->_finish();
+	}
+
+	return true;
+}
+
+void MetaPlatformSDK::_sweep_http_transfer_sinks(uint64_t p_now_usec) {
+	LocalVector<uint64_t> idle;
+	for (const KeyValue<uint64_t, Ref<MetaPlatformSDK_HttpTransferSink>> &E : http_transfer_sinks) {
+		if (E.value->_is_idle(p_now_usec)) {
+			idle.push_back(E.key);
+		}
+	}
+
+	for (uint64_t transfer_id : idle) {
+		Ref<MetaPlatformSDK_HttpTransferSink> sink = http_transfer_sinks[transfer_id];
+		http_transfer_sinks.erase(transfer_id);
+		sink->_fail(vformat("No data received for %s seconds.", sink->get_idle_timeout()));
+	}
+}
+
+void MetaPlatformSDK::_add_request_latency_monitors(int32_t p_message_type) {
+	Performance *performance = Performance::get_singleton();
+	String name = ovrMessageType_ToString((ovrMessageType)p_message_type);
+
+	StringName p50_id = vformat("MetaPlatformSDK Latency/%s p50 (ms)", name);
+	StringName p95_id = vformat("MetaPlatformSDK Latency/%s p95 (ms)", name);
+	if (performance->has_custom_monitor(p50_id)) {
+		return;
+	}
+
+	performance->add_custom_monitor(p50_id, callable_mp(this, &MetaPlatformSDK::_get_request_latency_monitor_value).bind(p_message_type, 0.5));
+	performance->add_custom_monitor(p95_id, callable_mp(this, &MetaPlatformSDK::_get_request_latency_monitor_value).bind(p_message_type, 0.95));
+	_performance_monitors.push_back(p50_id);
+	_performance_monitors.push_back(p95_id);
+}
+
+void MetaPlatformSDK::_drain_message_thread() {
+	MetaPlatformSDKPendingMessage pending;
+	while (message_thread.pop(pending)) {
+		pending_messages.push_back(pending);
+	}
+}
+#endif
+
+void MetaPlatformSDK::_add_performance_monitors() {
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (!_platform_initialized || !_performance_monitors.is_empty()) {
+		return;
+	}
+
+	Performance *performance = Performance::get_singleton();
+	const struct {
+		const char *id;
+		int32_t monitor;
+	} gauges[] = {
+		{ "MetaPlatformSDK/Pump Time (usec)", MONITOR_PUMP_TIME },
+		{ "MetaPlatformSDK/Queue Depth", MONITOR_QUEUE_DEPTH },
+		{ "MetaPlatformSDK/Requests In Flight", MONITOR_REQUESTS_IN_FLIGHT },
+	};
+	for (const auto &gauge : gauges) {
+		StringName id = gauge.id;
+		if (!performance->has_custom_monitor(id)) {
+			performance->add_custom_monitor(id, callable_mp(this, &MetaPlatformSDK::_get_monitor_value).bind(gauge.monitor));
+			_performance_monitors.push_back(id);
+		}
+	}
+
+	for (const KeyValue<int32_t, MetaPlatformSDKLatencyHistogram> &E : request_latencies.get_all()) {
+		_add_request_latency_monitors(E.key);
+	}
+#endif
+}
+
+void MetaPlatformSDK::_remove_performance_monitors() {
+	Performance *performance = Performance::get_singleton();
+	if (performance != nullptr) {
+		for (const StringName &id : _performance_monitors) {
+			if (performance->has_custom_monitor(id)) {
+				performance->remove_custom_monitor(id);
+			}
+		}
+	}
+	_performance_monitors.clear();
+}
+
+double MetaPlatformSDK::_get_monitor_value(int32_t p_monitor) const {
+	switch (p_monitor) {
+		case MONITOR_PUMP_TIME:
+			return _last_pump_usec;
+		case MONITOR_QUEUE_DEPTH:
+			return _last_pump_deferred;
+		case MONITOR_REQUESTS_IN_FLIGHT:
+			return get_pending_request_count();
+		default:
+			return 0.0;
+	}
+}
+
+double MetaPlatformSDK::_get_request_latency_monitor_value(int32_t p_message_type, double p_fraction) const {
+#ifdef META_PLATFORM_SDK_ENABLED
+	const MetaPlatformSDKLatencyHistogram *histogram = request_latencies.get(p_message_type);
+	if (histogram != nullptr) {
+		return histogram->get_percentile_usec(p_fraction) / 1000.0;
+	}
+#endif
+	return 0.0;
+}
+
+void MetaPlatformSDK::set_message_pump_automatic(bool p_enable) {
+	message_pump_automatic = p_enable;
+}
+
+bool MetaPlatformSDK::is_message_pump_automatic() const {
+	return message_pump_automatic;
+}
+
+void MetaPlatformSDK::set_message_pump_threaded(bool p_enable) {
+	if (message_pump_threaded == p_enable) {
+		return;
+	}
+	message_pump_threaded = p_enable;
+
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (_platform_initialized) {
+		if (p_enable) {
+			message_thread.start();
+		} else {
+			// Keep anything the thread already popped, so it's dispatched in order.
+			message_thread.stop();
+			_drain_message_thread();
+		}
+	}
+#endif
+}
+
+bool MetaPlatformSDK::is_message_pump_threaded() const {
+	return message_pump_threaded;
+}
+
+void MetaPlatformSDK::set_message_pump_time_budget_usec(int64_t p_usec) {
+	ERR_FAIL_COND(p_usec < 0);
+	message_pump_time_budget_usec = p_usec;
+}
+
+int64_t MetaPlatformSDK::get_message_pump_time_budget_usec() const {
+	return message_pump_time_budget_usec;
+}
+
+void MetaPlatformSDK::set_message_pump_max_messages(int32_t p_max_messages) {
+	ERR_FAIL_COND(p_max_messages < 0);
+	message_pump_max_messages = p_max_messages;
+}
+
+int32_t MetaPlatformSDK::get_message_pump_max_messages() const {
+	return message_pump_max_messages;
+}
+
+int32_t MetaPlatformSDK::pump_messages() {
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (!_platform_initialized) {
+		return 0;
+	}
+
+	// A handler may call this from within a signal emitted by us, which would dispatch out of order.
+	ERR_FAIL_COND_V_MSG(_pumping_messages, 0, "MetaPlatformSDK: Cannot pump messages from within a message handler.");
+	_pumping_messages = true;
+
+	Time *time = Time::get_singleton();
+	uint64_t start_usec = time->get_ticks_usec();
+
+	// Take everything the SDK has queued up. Popping is cheap; it's dispatching that we need to budget.
+	uint32_t popped = pending_messages.size();
+	if (message_pump_threaded) {
+		_drain_message_thread();
+		// Draining may have made room in the ring, so don't wait for the next poll to fill it again.
+		message_thread.wake();
+	} else {
+		while (ovrMessageHandle message_handle = ovr_PopMessage()) {
+			pending_messages.push_back(MetaPlatformSDKPendingMessage::decode(message_handle));
 		}
 	}
+	popped = pending_messages.size() - popped;
+
+	uint32_t coalesced = pending_messages.size();
+	if (notification_coalescing && pending_messages.size() - pending_messages_head > 1) {
+		_coalesce_pending_messages();
+	}
+	coalesced -= pending_messages.size();
+
+	uint32_t dispatched = 0;
+	while (pending_messages_head < pending_messages.size()) {
+		if (message_pump_max_messages > 0 && dispatched >= (uint32_t)message_pump_max_messages) {
+			break;
+		}
+		// Always dispatch at least one message, so that we're guaranteed to make progress.
+		if (message_pump_time_budget_usec > 0 && dispatched > 0 && time->get_ticks_usec() - start_usec >= (uint64_t)message_pump_time_budget_usec) {
+			break;
+		}
+
+		// Copy, because a handler may cause more messages to be queued.
+		MetaPlatformSDKPendingMessage pending = pending_messages[pending_messages_head++];
+		_dispatch_message(pending);
+		dispatched++;
+	}
+
+	// Anything left over will be dispatched on the next pump.
+	uint32_t deferred = pending_messages.size() - pending_messages_head;
+	if (deferred == 0) {
+		pending_messages.clear();
+		pending_messages_head = 0;
+	} else if (pending_messages_head > 0) {
+		for (uint32_t i = 0; i < deferred; i++) {
+			pending_messages[i] = pending_messages[pending_messages_head + i];
+		}
+		pending_messages.resize(deferred);
+		pending_messages_head = 0;
+	}
+
+	_sweep_requests(time->get_ticks_usec());
+	if (!http_transfer_sinks.is_empty()) {
+		_sweep_http_transfer_sinks(time->get_ticks_usec());
+	}
+
+	// The messages dispatched above, and whatever results were taken from them, can be reused once they're dropped.
+	MetaPlatformSDKObjectPoolBase::sweep_all();
+
+	_last_pump_popped = popped;
+	_last_pump_dispatched = dispatched;
+	_last_pump_deferred = deferred;
+	_last_pump_coalesced = coalesced;
+	_last_pump_usec = time->get_ticks_usec() - start_usec;
+
+	_pumping_messages = false;
+	return dispatched;
+#else
+	return 0;
+#endif
+}
+
+void MetaPlatformSDK::set_request_default_timeout(double p_seconds) {
+	ERR_FAIL_COND(p_seconds < 0.0);
+	request_default_timeout = p_seconds;
+}
+
+double MetaPlatformSDK::get_request_default_timeout() const {
+	return request_default_timeout;
+}
+
+void MetaPlatformSDK::set_request_stale_threshold(double p_seconds) {
+	ERR_FAIL_COND(p_seconds < 0.0);
+	request_stale_threshold = p_seconds;
+}
+
+double MetaPlatformSDK::get_request_stale_threshold() const {
+	return request_stale_threshold;
+}
+
+int32_t MetaPlatformSDK::get_pending_request_count() const {
+#ifdef META_PLATFORM_SDK_ENABLED
+	return requests.size();
+#else
+	return 0;
+#endif
+}
+
+void MetaPlatformSDK::set_request_coalescing(bool p_enable) {
+	request_coalescing = p_enable;
+}
+
+bool MetaPlatformSDK::is_request_coalescing() const {
+	return request_coalescing;
+}
+
+Dictionary MetaPlatformSDK::get_request_coalescing_stats() const {
+#ifdef META_PLATFORM_SDK_ENABLED
+	return request_coalescer.get_stats();
+#else
+	return Dictionary();
+#endif
+}
+
+Dictionary MetaPlatformSDK::get_request_latency_stats() const {
+	Dictionary stats;
+#ifdef META_PLATFORM_SDK_ENABLED
+	for (const KeyValue<int32_t, MetaPlatformSDKLatencyHistogram> &E : request_latencies.get_all()) {
+		stats[E.key] = MetaPlatformSDKLatencyStats::histogram_to_dictionary(E.value);
+	}
+#endif
+	return stats;
+}
+
+Dictionary MetaPlatformSDK::get_allocation_stats() const {
+	return MetaPlatformSDKAllocationCounter::get_stats();
+}
+
+void MetaPlatformSDK::reset_request_latency_stats() {
+#ifdef META_PLATFORM_SDK_ENABLED
+	// The per-API monitors keep reading from the histograms, which start over from empty.
+	request_latencies.clear();
+#endif
+}
+
+void MetaPlatformSDK::set_detach_messages(bool p_enable) {
+	detach_messages = p_enable;
+}
+
+bool MetaPlatformSDK::is_detach_messages() const {
+	return detach_messages;
+}
+
+void MetaPlatformSDK::set_notification_coalescing(bool p_enable) {
+	notification_coalescing = p_enable;
+}
+
+bool MetaPlatformSDK::is_notification_coalescing() const {
+	return notification_coalescing;
+}
+
+Dictionary MetaPlatformSDK::get_notification_coalescing_stats() const {
+	Dictionary stats;
+#ifdef META_PLATFORM_SDK_ENABLED
+	for (const KeyValue<int32_t, uint64_t> &E : coalesced_notifications) {
+		stats[E.key] = E.value;
+	}
+#endif
+	return stats;
+}
+
+void MetaPlatformSDK::set_string_cache_size(int32_t p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	MetaPlatformSDKStringCache::set_size(p_size);
+}
+
+int32_t MetaPlatformSDK::get_string_cache_size() const {
+	return MetaPlatformSDKStringCache::get_size();
+}
+
+Dictionary MetaPlatformSDK::get_string_cache_stats() const {
+	return MetaPlatformSDKStringCache::get_stats();
+}
+
+void MetaPlatformSDK::clear_string_cache() {
+	MetaPlatformSDKStringCache::clear();
+}
+
+void MetaPlatformSDK::set_object_pool_size(int32_t p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	MetaPlatformSDKObjectPoolBase::set_max_size(p_size);
+}
+
+int32_t MetaPlatformSDK::get_object_pool_size() const {
+	return MetaPlatformSDKObjectPoolBase::get_max_size();
+}
+
+void MetaPlatformSDK::set_performance_monitors_enabled(bool p_enable) {
+	if (performance_monitors_enabled == p_enable) {
+		return;
+	}
+	performance_monitors_enabled = p_enable;
+
+	if (p_enable) {
+		_add_performance_monitors();
+	} else {
+		_remove_performance_monitors();
+	}
+}
+
+bool MetaPlatformSDK::is_performance_monitors_enabled() const {
+	return performance_monitors_enabled;
+}
+
+void MetaPlatformSDK::register_http_transfer_sink(uint64_t p_transfer_id, const Ref<MetaPlatformSDK_HttpTransferSink> &p_sink) {
+	ERR_FAIL_COND(p_sink.is_null());
+	ERR_FAIL_COND_MSG(p_sink->is_finished(), "MetaPlatformSDK: HTTP transfer sink has already finished.");
+	ERR_FAIL_COND_MSG(http_transfer_sinks.has(p_transfer_id), vformat("MetaPlatformSDK: HTTP transfer %s already has a sink registered.", p_transfer_id));
+
+	p_sink->_set_transfer_id(p_transfer_id);
+	http_transfer_sinks.insert(p_transfer_id, p_sink);
+}
+
+void MetaPlatformSDK::unregister_http_transfer_sink(uint64_t p_transfer_id) {
+	Ref<MetaPlatformSDK_HttpTransferSink> *sink_ptr = http_transfer_sinks.getptr(p_transfer_id);
+	if (sink_ptr == nullptr) {
+		return;
+	}
+
+	Ref<MetaPlatformSDK_HttpTransferSink> sink = *sink_ptr;
+	http_transfer_sinks.erase(p_transfer_id);
+	sink->_fail("Unregistered before the transfer completed.");
 }
+
+void MetaPlatformSDK::register_notification_handler(MessageType p_type, const Callable &p_handler, const Variant &p_filter_id) {
+	ERR_FAIL_COND(!p_handler.is_valid());
+	ERR_FAIL_COND_MSG(p_filter_id.get_type() != Variant::NIL && p_filter_id.get_type() != Variant::INT, "MetaPlatformSDK: The notification filter must be an id or null.");
+
+#ifdef META_PLATFORM_SDK_ENABLED
+	ovrMessageType ovr_type = (ovrMessageType)p_type;
+	int32_t index = _get_notification_index(ovr_type);
+	ERR_FAIL_COND_MSG(index < 0, vformat("MetaPlatformSDK: Message type %s isn't a notification.", ovrMessageType_ToString(ovr_type)));
+	ERR_FAIL_COND_MSG(p_filter_id.get_type() != Variant::NIL && !_is_notification_filterable(ovr_type), vformat("MetaPlatformSDK: Notification %s can't be filtered by id.", ovrMessageType_ToString(ovr_type)));
+
+	NotificationHandler handler;
+	handler.callable = p_handler;
+	if (p_filter_id.get_type() == Variant::INT) {
+		handler.has_filter = true;
+		handler.filter_id = (uint64_t)(int64_t)p_filter_id;
+	}
+	notification_handlers[index].push_back(handler);
 #endif
+}
+
+void MetaPlatformSDK::unregister_notification_handler(MessageType p_type, const Callable &p_handler, const Variant &p_filter_id) {
+#ifdef META_PLATFORM_SDK_ENABLED
+	int32_t index = _get_notification_index((ovrMessageType)p_type);
+	ERR_FAIL_COND(index < 0);
+
+	bool has_filter = p_filter_id.get_type() == Variant::INT;
+	uint64_t filter_id = has_filter ? (uint64_t)(int64_t)p_filter_id : 0;
+
+	LocalVector<NotificationHandler> &handlers = notification_handlers[index];
+	for (uint32_t i = handlers.size(); i > 0; i--) {
+		NotificationHandler &handler = handlers[i - 1];
+		if (handler.callable != p_handler || handler.has_filter != has_filter || handler.filter_id != filter_id) {
+			continue;
+		}
+
+		if (_dispatching_notification_index == index) {
+			handler.callable = Callable();
+			_notification_handlers_dirty = true;
+		} else {
+			handlers.remove_at(i - 1);
+		}
+	}
+#endif
+}
+
+Dictionary MetaPlatformSDK::get_message_pump_stats() const {
+	Dictionary stats;
+	stats["popped"] = _last_pump_popped;
+	stats["dispatched"] = _last_pump_dispatched;
+	stats["deferred"] = _last_pump_deferred;
+	stats["coalesced"] = _last_pump_coalesced;
+	stats["elapsed_usec"] = _last_pump_usec;
+	return stats;
+}
 
 /*
  * Next, hand-written functions for other generated classes.
  */
 
 uint64_t MetaPlatformSDK_Message::get_request_id() const {
-#ifdef ANDROID_ENABLED
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (snapshot != nullptr) {
+		return snapshot->request_id;
+	}
 	return ovr_Message_GetRequestID(handle);
 #else
 	return 0;
 #endif
 }
 
+void MetaPlatformSDK_Message::detach() {
+#ifdef META_PLATFORM_SDK_ENABLED
+	_snapshot();
+#endif
+}
+
+bool MetaPlatformSDK_Message::is_detached() const {
+#ifdef META_PLATFORM_SDK_ENABLED
+	return snapshot != nullptr;
+#else
+	return false;
+#endif
+}
+
 bool MetaPlatformSDK_Message::is_notification() const {
-#ifdef ANDROID_ENABLED
+#ifdef META_PLATFORM_SDK_ENABLED
 	return ovrMessageType_IsNotification((ovrMessageType)type);
 #else
 	return 0;
@@ -157,7 +942,10 @@ bool MetaPlatformSDK_Message::is_notification() const {
 }
 
 uint64_t MetaPlatformSDK_HttpTransferUpdate::get_id() const {
-#ifdef ANDROID_ENABLED
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (snapshot != nullptr) {
+		return snapshot->id;
+	}
 	return ovr_HttpTransferUpdate_GetID(handle);
 #else
 	return 0;
@@ -165,77 +953,95 @@ uint64_t MetaPlatformSDK_HttpTransferUpdate::get_id() const {
 }
 
 PackedByteArray MetaPlatformSDK_ChallengeEntry::get_extra_data() const {
-#ifdef ANDROID_ENABLED
-	PackedByteArray result;
-
-	const char *data = ovr_ChallengeEntry_GetExtraData(handle);
-	if (data) {
-		size_t size = ovr_ChallengeEntry_GetExtraDataLength(handle);
-		if (size > 0) {
-			result.resize(size);
-			memcpy(result.ptrw(), data, size);
-		}
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (snapshot != nullptr) {
+		return snapshot->extra_data;
 	}
-
-	return result;
+	return bytes_to_packed_byte_array(ovr_ChallengeEntry_GetExtraData(handle), ovr_ChallengeEntry_GetExtraDataLength(handle));
 #else
 	return PackedByteArray();
 #endif
 }
 
-PackedByteArray MetaPlatformSDK_LeaderboardEntry::get_extra_data() const {
-#ifdef ANDROID_ENABLED
-	PackedByteArray result;
-
-	const char *data = ovr_LeaderboardEntry_GetExtraData(handle);
-	if (data) {
-		size_t size = ovr_LeaderboardEntry_GetExtraDataLength(handle);
-		if (size > 0) {
-			result.resize(size);
-			memcpy(result.ptrw(), data, size);
-		}
+int64_t MetaPlatformSDK_ChallengeEntry::get_extra_data_into(const Ref<MetaPlatformSDK_ByteBuffer> &p_buffer, int64_t p_offset) const {
+	ERR_FAIL_COND_V(p_buffer.is_null(), 0);
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (snapshot != nullptr) {
+		return p_buffer->_write(snapshot->extra_data.ptr(), snapshot->extra_data.size(), p_offset);
 	}
+	return p_buffer->_write(ovr_ChallengeEntry_GetExtraData(handle), ovr_ChallengeEntry_GetExtraDataLength(handle), p_offset);
+#else
+	return 0;
+#endif
+}
 
-	return result;
+#ifdef META_PLATFORM_SDK_MODULE_LEADERBOARD
+PackedByteArray MetaPlatformSDK_LeaderboardEntry::get_extra_data() const {
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (snapshot != nullptr) {
+		return snapshot->extra_data;
+	}
+	return bytes_to_packed_byte_array(ovr_LeaderboardEntry_GetExtraData(handle), ovr_LeaderboardEntry_GetExtraDataLength(handle));
 #else
 	return PackedByteArray();
 #endif
 }
 
-PackedByteArray MetaPlatformSDK_HttpTransferUpdate::get_bytes() const {
-#ifdef ANDROID_ENABLED
-	PackedByteArray result;
-
-	const void *data = ovr_HttpTransferUpdate_GetBytes(handle);
-	if (data) {
-		size_t size = ovr_HttpTransferUpdate_GetSize(handle);
-		if (size > 0) {
-			result.resize(size);
-			memcpy(result.ptrw(), data, size);
-		}
+int64_t MetaPlatformSDK_LeaderboardEntry::get_extra_data_into(const Ref<MetaPlatformSDK_ByteBuffer> &p_buffer, int64_t p_offset) const {
+	ERR_FAIL_COND_V(p_buffer.is_null(), 0);
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (snapshot != nullptr) {
+		return p_buffer->_write(snapshot->extra_data.ptr(), snapshot->extra_data.size(), p_offset);
 	}
+	return p_buffer->_write(ovr_LeaderboardEntry_GetExtraData(handle), ovr_LeaderboardEntry_GetExtraDataLength(handle), p_offset);
+#else
+	return 0;
+#endif
+}
+#endif // META_PLATFORM_SDK_MODULE_LEADERBOARD
 
-	return result;
+PackedByteArray MetaPlatformSDK_HttpTransferUpdate::get_bytes() const {
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (snapshot != nullptr) {
+		return snapshot->bytes;
+	}
+	return bytes_to_packed_byte_array(ovr_HttpTransferUpdate_GetBytes(handle), ovr_HttpTransferUpdate_GetSize(handle));
 #else
 	return PackedByteArray();
 #endif
 }
 
-PackedByteArray MetaPlatformSDK_Packet::get_bytes() const {
-#ifdef ANDROID_ENABLED
-	PackedByteArray result;
-
-	const void *data = ovr_Packet_GetBytes(handle);
-	if (data) {
-		size_t size = ovr_Packet_GetSize(handle);
-		if (size > 0) {
-			result.resize(size);
-			memcpy(result.ptrw(), data, size);
-		}
+int64_t MetaPlatformSDK_HttpTransferUpdate::get_bytes_into(const Ref<MetaPlatformSDK_ByteBuffer> &p_buffer, int64_t p_offset) const {
+	ERR_FAIL_COND_V(p_buffer.is_null(), 0);
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (snapshot != nullptr) {
+		return p_buffer->_write(snapshot->bytes.ptr(), snapshot->bytes.size(), p_offset);
 	}
+	return p_buffer->_write(ovr_HttpTransferUpdate_GetBytes(handle), ovr_HttpTransferUpdate_GetSize(handle), p_offset);
+#else
+	return 0;
+#endif
+}
 
-	return result;
+PackedByteArray MetaPlatformSDK_Packet::get_bytes() const {
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (snapshot != nullptr) {
+		return snapshot->bytes;
+	}
+	return bytes_to_packed_byte_array(ovr_Packet_GetBytes(handle), ovr_Packet_GetSize(handle));
 #else
 	return PackedByteArray();
 #endif
 }
+
+int64_t MetaPlatformSDK_Packet::get_bytes_into(const Ref<MetaPlatformSDK_ByteBuffer> &p_buffer, int64_t p_offset) const {
+	ERR_FAIL_COND_V(p_buffer.is_null(), 0);
+#ifdef META_PLATFORM_SDK_ENABLED
+	if (snapshot != nullptr) {
+		return p_buffer->_write(snapshot->bytes.ptr(), snapshot->bytes.size(), p_offset);
+	}
+	return p_buffer->_write(ovr_Packet_GetBytes(handle), ovr_Packet_GetSize(handle), p_offset);
+#else
+	return 0;
+#endif
+}
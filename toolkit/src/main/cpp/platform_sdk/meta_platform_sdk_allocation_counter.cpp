@@ -0,0 +1,25 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_allocation_counter.h"
+
+// Constant initialized, so it's ready before any of the counters are constructed.
+MetaPlatformSDKAllocationCounter *MetaPlatformSDKAllocationCounter::first = nullptr;
+
+Dictionary MetaPlatformSDKAllocationCounter::get_stats() {
+	Dictionary stats;
+	for (const MetaPlatformSDKAllocationCounter *counter = first; counter != nullptr; counter = counter->next) {
+		uint64_t created = counter->created.load(std::memory_order_relaxed);
+		if (created == 0) {
+			continue;
+		}
+		uint64_t freed = counter->freed.load(std::memory_order_relaxed);
+
+		Dictionary class_stats;
+		class_stats["created"] = created;
+		class_stats["freed"] = freed;
+		class_stats["live"] = created - freed;
+		class_stats["reused"] = counter->reused.load(std::memory_order_relaxed);
+		stats[counter->class_name] = class_stats;
+	}
+	return stats;
+}
@@ -0,0 +1,9 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_binding_table.h"
+
+void meta_platform_sdk_bind_enum(const StringName &p_class, const StringName &p_enum, const MetaPlatformSDKConstantBinding *p_constants, size_t p_count) {
+	for (size_t i = 0; i < p_count; i++) {
+		ClassDB::bind_integer_constant(p_class, p_enum, p_constants[i].name, p_constants[i].value);
+	}
+}
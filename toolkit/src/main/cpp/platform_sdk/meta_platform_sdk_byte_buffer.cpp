@@ -0,0 +1,87 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_byte_buffer.h"
+
+#include <godot_cpp/core/class_db.hpp>
+
+LocalVector<Ref<MetaPlatformSDK_ByteBuffer>> MetaPlatformSDK_ByteBuffer::pool;
+
+void MetaPlatformSDK_ByteBuffer::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("get_data"), &MetaPlatformSDK_ByteBuffer::get_data);
+	ClassDB::bind_method(D_METHOD("get_size"), &MetaPlatformSDK_ByteBuffer::get_size);
+	ClassDB::bind_method(D_METHOD("resize", "size"), &MetaPlatformSDK_ByteBuffer::resize);
+	ClassDB::bind_method(D_METHOD("release"), &MetaPlatformSDK_ByteBuffer::release);
+	ClassDB::bind_static_method("MetaPlatformSDK_ByteBuffer", D_METHOD("acquire", "min_size"), &MetaPlatformSDK_ByteBuffer::acquire, DEFVAL(0));
+
+	ADD_PROPERTY(PropertyInfo(Variant::PACKED_BYTE_ARRAY, "data"), "", "get_data");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "size"), "resize", "get_size");
+}
+
+String MetaPlatformSDK_ByteBuffer::_to_string() const {
+	return String("[MetaPlatformSDK_ByteBuffer:") + itos(get_instance_id()) + String(" size=") + itos(get_size()) + String("]");
+}
+
+int64_t MetaPlatformSDK_ByteBuffer::_write(const void *p_data, size_t p_size, int64_t p_offset) {
+	ERR_FAIL_COND_V(p_offset < 0, 0);
+	if (p_data == nullptr || p_size == 0) {
+		return 0;
+	}
+
+	int64_t end = p_offset + (int64_t)p_size;
+	if (end > data.size()) {
+		data.resize(end);
+	}
+	memcpy(data.ptrw() + p_offset, p_data, p_size);
+
+	return p_size;
+}
+
+Ref<MetaPlatformSDK_ByteBuffer> MetaPlatformSDK_ByteBuffer::acquire(int64_t p_min_size) {
+	ERR_FAIL_COND_V(p_min_size < 0, Ref<MetaPlatformSDK_ByteBuffer>());
+
+	Ref<MetaPlatformSDK_ByteBuffer> buffer;
+
+	// Prefer a buffer that's already big enough, so we don't have to reallocate.
+	for (uint32_t i = 0; i < pool.size(); i++) {
+		if (pool[i]->data.size() >= p_min_size) {
+			buffer = pool[i];
+			pool.remove_at_unordered(i);
+			break;
+		}
+	}
+	if (buffer.is_null() && pool.size() > 0) {
+		buffer = pool[pool.size() - 1];
+		pool.resize(pool.size() - 1);
+	}
+	if (buffer.is_null()) {
+		buffer.instantiate();
+	}
+
+	buffer->pooled = false;
+	if (buffer->data.size() < p_min_size) {
+		buffer->data.resize(p_min_size);
+	}
+
+	return buffer;
+}
+
+void MetaPlatformSDK_ByteBuffer::release() {
+	ERR_FAIL_COND_MSG(pooled, "MetaPlatformSDK_ByteBuffer has already been released.");
+	if (pool.size() >= MAX_POOLED_BUFFERS) {
+		return;
+	}
+	pooled = true;
+	pool.push_back(Ref<MetaPlatformSDK_ByteBuffer>(this));
+}
+
+void MetaPlatformSDK_ByteBuffer::_clear_pool() {
+	pool.reset();
+}
+
+void MetaPlatformSDK_ByteBuffer::resize(int64_t p_size) {
+	ERR_FAIL_COND(p_size < 0);
+	data.resize(p_size);
+}
+
+MetaPlatformSDK_ByteBuffer::MetaPlatformSDK_ByteBuffer() {
+}
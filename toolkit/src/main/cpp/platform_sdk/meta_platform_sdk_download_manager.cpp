@@ -0,0 +1,375 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_download_manager.h"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/project_settings.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+#include "platform_sdk/meta_platform_sdk.h"
+#include "platform_sdk/meta_platform_sdk_asset_file_download_result.h"
+#include "platform_sdk/meta_platform_sdk_asset_file_download_update.h"
+#include "platform_sdk/meta_platform_sdk_message.h"
+
+void MetaPlatformSDK_DownloadManager::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_max_concurrent_downloads", "max_downloads"), &MetaPlatformSDK_DownloadManager::set_max_concurrent_downloads);
+	ClassDB::bind_method(D_METHOD("get_max_concurrent_downloads"), &MetaPlatformSDK_DownloadManager::get_max_concurrent_downloads);
+	ClassDB::bind_method(D_METHOD("set_progress_interval", "seconds"), &MetaPlatformSDK_DownloadManager::set_progress_interval);
+	ClassDB::bind_method(D_METHOD("get_progress_interval"), &MetaPlatformSDK_DownloadManager::get_progress_interval);
+	ClassDB::bind_method(D_METHOD("enqueue", "asset_file_id", "priority", "load_resource_pack"), &MetaPlatformSDK_DownloadManager::enqueue, DEFVAL(0), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("set_priority", "asset_file_id", "priority"), &MetaPlatformSDK_DownloadManager::set_priority);
+	ClassDB::bind_method(D_METHOD("pause", "asset_file_id"), &MetaPlatformSDK_DownloadManager::pause);
+	ClassDB::bind_method(D_METHOD("resume", "asset_file_id"), &MetaPlatformSDK_DownloadManager::resume);
+	ClassDB::bind_method(D_METHOD("cancel", "asset_file_id"), &MetaPlatformSDK_DownloadManager::cancel);
+	ClassDB::bind_method(D_METHOD("clear_finished"), &MetaPlatformSDK_DownloadManager::clear_finished);
+	ClassDB::bind_method(D_METHOD("has_download", "asset_file_id"), &MetaPlatformSDK_DownloadManager::has_download);
+	ClassDB::bind_method(D_METHOD("get_download_status", "asset_file_id"), &MetaPlatformSDK_DownloadManager::get_download_status);
+	ClassDB::bind_method(D_METHOD("get_download", "asset_file_id"), &MetaPlatformSDK_DownloadManager::get_download);
+	ClassDB::bind_method(D_METHOD("get_download_ids"), &MetaPlatformSDK_DownloadManager::get_download_ids);
+	ClassDB::bind_method(D_METHOD("get_progress"), &MetaPlatformSDK_DownloadManager::get_progress);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_concurrent_downloads", PROPERTY_HINT_RANGE, "1,16,1,or_greater"), "set_max_concurrent_downloads", "get_max_concurrent_downloads");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "progress_interval", PROPERTY_HINT_RANGE, "0,10,0.01,or_greater,suffix:s"), "set_progress_interval", "get_progress_interval");
+
+	ADD_SIGNAL(MethodInfo("download_started", PropertyInfo(Variant::INT, "asset_file_id")));
+	ADD_SIGNAL(MethodInfo("download_completed", PropertyInfo(Variant::INT, "asset_file_id"), PropertyInfo(Variant::STRING, "file_path")));
+	ADD_SIGNAL(MethodInfo("download_failed", PropertyInfo(Variant::INT, "asset_file_id"), PropertyInfo(Variant::OBJECT, "message", PROPERTY_HINT_RESOURCE_TYPE, "MetaPlatformSDK_Message")));
+	ADD_SIGNAL(MethodInfo("download_cancelled", PropertyInfo(Variant::INT, "asset_file_id")));
+	ADD_SIGNAL(MethodInfo("progress", PropertyInfo(Variant::INT, "bytes_transferred"), PropertyInfo(Variant::INT, "bytes_total")));
+	ADD_SIGNAL(MethodInfo("resource_pack_loaded", PropertyInfo(Variant::INT, "asset_file_id"), PropertyInfo(Variant::BOOL, "success")));
+
+	BIND_ENUM_CONSTANT(DOWNLOAD_QUEUED);
+	BIND_ENUM_CONSTANT(DOWNLOAD_ACTIVE);
+	BIND_ENUM_CONSTANT(DOWNLOAD_PAUSED);
+	BIND_ENUM_CONSTANT(DOWNLOAD_COMPLETED);
+	BIND_ENUM_CONSTANT(DOWNLOAD_FAILED);
+}
+
+void MetaPlatformSDK_DownloadManager::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_READY: {
+			if (Engine::get_singleton()->is_editor_hint()) {
+				return;
+			}
+			set_process_internal(true);
+		} break;
+
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			if (!progress_changed) {
+				return;
+			}
+			uint64_t now = Time::get_singleton()->get_ticks_usec();
+			if (now - last_progress_usec >= (uint64_t)(progress_interval * 1000000.0)) {
+				_emit_progress();
+			}
+		} break;
+	}
+}
+
+void MetaPlatformSDK_DownloadManager::set_max_concurrent_downloads(int32_t p_max_downloads) {
+	ERR_FAIL_COND(p_max_downloads < 1);
+	max_concurrent_downloads = p_max_downloads;
+	_start_next();
+}
+
+void MetaPlatformSDK_DownloadManager::set_progress_interval(double p_seconds) {
+	ERR_FAIL_COND(p_seconds < 0.0);
+	progress_interval = p_seconds;
+}
+
+int32_t MetaPlatformSDK_DownloadManager::_count(DownloadStatus p_status) const {
+	int32_t count = 0;
+	for (const KeyValue<uint64_t, Download> &E : downloads) {
+		if (E.value.status == p_status) {
+			count++;
+		}
+	}
+	return count;
+}
+
+void MetaPlatformSDK_DownloadManager::_start_next() {
+	int32_t active = _count(DOWNLOAD_ACTIVE);
+	while (active < max_concurrent_downloads) {
+		uint64_t next_id = 0;
+		Download *next = nullptr;
+		for (KeyValue<uint64_t, Download> &E : downloads) {
+			Download &download = E.value;
+			if (download.status != DOWNLOAD_QUEUED) {
+				continue;
+			}
+			if (next == nullptr || download.priority > next->priority || (download.priority == next->priority && download.sequence < next->sequence)) {
+				next_id = E.key;
+				next = &download;
+			}
+		}
+		if (next == nullptr) {
+			return;
+		}
+
+		if (_start(next_id, *next)) {
+			active++;
+		}
+	}
+}
+
+bool MetaPlatformSDK_DownloadManager::_start(uint64_t p_asset_file_id, Download &p_download) {
+	MetaPlatformSDK *platform_sdk = MetaPlatformSDK::get_singleton();
+
+	p_download.status = DOWNLOAD_ACTIVE;
+	p_download.started = false;
+
+	// Registered before the request, so no updates are missed.
+	platform_sdk->register_notification_handler(MetaPlatformSDK::MESSAGE_NOTIFICATION_ASSET_FILE_DOWNLOAD_UPDATE, callable_mp(this, &MetaPlatformSDK_DownloadManager::_on_download_update), p_asset_file_id);
+
+	Ref<MetaPlatformSDK_Request> request = platform_sdk->asset_file_download_by_id_async(p_asset_file_id);
+	if (request.is_null()) {
+		_stop(p_asset_file_id);
+		p_download.status = DOWNLOAD_FAILED;
+		emit_signal("download_failed", p_asset_file_id, Ref<MetaPlatformSDK_Message>());
+		return false;
+	}
+	request->then(callable_mp(this, &MetaPlatformSDK_DownloadManager::_on_download_started).bind(p_asset_file_id));
+	request->connect("timed_out", callable_mp(this, &MetaPlatformSDK_DownloadManager::_on_download_timed_out).bind(p_asset_file_id));
+	return true;
+}
+
+void MetaPlatformSDK_DownloadManager::_stop(uint64_t p_asset_file_id) {
+	MetaPlatformSDK::get_singleton()->unregister_notification_handler(MetaPlatformSDK::MESSAGE_NOTIFICATION_ASSET_FILE_DOWNLOAD_UPDATE, callable_mp(this, &MetaPlatformSDK_DownloadManager::_on_download_update), p_asset_file_id);
+}
+
+void MetaPlatformSDK_DownloadManager::_emit_progress() {
+	int64_t bytes_transferred = 0;
+	int64_t bytes_total = 0;
+	for (const KeyValue<uint64_t, Download> &E : downloads) {
+		if (E.value.status != DOWNLOAD_FAILED) {
+			bytes_transferred += E.value.bytes_transferred;
+			bytes_total += E.value.bytes_total;
+		}
+	}
+
+	progress_changed = false;
+	last_progress_usec = Time::get_singleton()->get_ticks_usec();
+	emit_signal("progress", bytes_transferred, bytes_total);
+}
+
+void MetaPlatformSDK_DownloadManager::_on_download_started(const Ref<MetaPlatformSDK_Message> &p_message, uint64_t p_asset_file_id) {
+	Download *download = downloads.getptr(p_asset_file_id);
+	if (download == nullptr || download->status != DOWNLOAD_ACTIVE || download->started) {
+		// It was paused or cancelled in the meantime.
+		return;
+	}
+
+	if (p_message->is_error()) {
+		_stop(p_asset_file_id);
+		download->status = DOWNLOAD_FAILED;
+		emit_signal("download_failed", p_asset_file_id, p_message);
+		_start_next();
+		return;
+	}
+
+	Ref<MetaPlatformSDK_AssetFileDownloadResult> result = p_message->get_data();
+	if (result.is_valid()) {
+		download->file_path = result->get_filepath();
+	}
+	download->started = true;
+	emit_signal("download_started", p_asset_file_id);
+}
+
+void MetaPlatformSDK_DownloadManager::_on_download_update(const Ref<MetaPlatformSDK_Message> &p_message) {
+	if (p_message->is_error()) {
+		return;
+	}
+
+	Ref<MetaPlatformSDK_AssetFileDownloadUpdate> update = p_message->get_data();
+	ERR_FAIL_COND(update.is_null());
+	uint64_t asset_file_id = update->get_asset_id();
+	Download *download = downloads.getptr(asset_file_id);
+	if (download == nullptr || download->status != DOWNLOAD_ACTIVE) {
+		return;
+	}
+
+	download->bytes_transferred = update->get_bytes_transferred();
+	download->bytes_total = update->get_bytes_total();
+	progress_changed = true;
+
+	if (!update->get_completed()) {
+		return;
+	}
+
+	_stop(asset_file_id);
+	download->status = DOWNLOAD_COMPLETED;
+	String file_path = download->file_path;
+	bool load_resource_pack = download->load_resource_pack;
+
+	// Always report the final progress, so it doesn't stop short of the total.
+	_emit_progress();
+	emit_signal("download_completed", asset_file_id, file_path);
+	if (load_resource_pack) {
+		callable_mp(this, &MetaPlatformSDK_DownloadManager::_load_resource_pack).call_deferred(asset_file_id, file_path);
+	}
+	_start_next();
+}
+
+void MetaPlatformSDK_DownloadManager::_on_download_timed_out(uint64_t p_asset_file_id) {
+	Download *download = downloads.getptr(p_asset_file_id);
+	if (download == nullptr || download->status != DOWNLOAD_ACTIVE || download->started) {
+		return;
+	}
+
+	_stop(p_asset_file_id);
+	download->status = DOWNLOAD_FAILED;
+	emit_signal("download_failed", p_asset_file_id, Ref<MetaPlatformSDK_Message>());
+	_start_next();
+}
+
+void MetaPlatformSDK_DownloadManager::_load_resource_pack(uint64_t p_asset_file_id, const String &p_file_path) {
+	bool success = ProjectSettings::get_singleton()->load_resource_pack(p_file_path);
+	if (!success) {
+		ERR_PRINT(vformat("MetaPlatformSDK: Unable to load the resource pack from asset file %s at %s", p_asset_file_id, p_file_path));
+	}
+	emit_signal("resource_pack_loaded", p_asset_file_id, success);
+}
+
+void MetaPlatformSDK_DownloadManager::enqueue(uint64_t p_asset_file_id, int32_t p_priority, bool p_load_resource_pack) {
+	Download *existing = downloads.getptr(p_asset_file_id);
+	if (existing != nullptr && existing->status != DOWNLOAD_FAILED) {
+		// Already known, so only its priority can change.
+		existing->priority = p_priority;
+		existing->load_resource_pack = existing->load_resource_pack || p_load_resource_pack;
+		return;
+	}
+
+	Download download;
+	download.priority = p_priority;
+	download.sequence = next_sequence++;
+	download.load_resource_pack = p_load_resource_pack;
+	downloads.insert(p_asset_file_id, download);
+
+	_start_next();
+}
+
+void MetaPlatformSDK_DownloadManager::set_priority(uint64_t p_asset_file_id, int32_t p_priority) {
+	Download *download = downloads.getptr(p_asset_file_id);
+	ERR_FAIL_NULL_MSG(download, vformat("MetaPlatformSDK: Asset file %s isn't in the download manager.", p_asset_file_id));
+	download->priority = p_priority;
+}
+
+void MetaPlatformSDK_DownloadManager::pause(uint64_t p_asset_file_id) {
+	Download *download = downloads.getptr(p_asset_file_id);
+	ERR_FAIL_NULL_MSG(download, vformat("MetaPlatformSDK: Asset file %s isn't in the download manager.", p_asset_file_id));
+
+	if (download->status == DOWNLOAD_ACTIVE) {
+		// The Platform SDK can't pause downloads, so this cancels it, and it starts over when resumed.
+		_stop(p_asset_file_id);
+		MetaPlatformSDK::get_singleton()->asset_file_download_cancel_by_id_async(p_asset_file_id);
+		download->status = DOWNLOAD_PAUSED;
+		download->bytes_transferred = 0;
+		progress_changed = true;
+		_start_next();
+	} else if (download->status == DOWNLOAD_QUEUED) {
+		download->status = DOWNLOAD_PAUSED;
+	}
+}
+
+void MetaPlatformSDK_DownloadManager::resume(uint64_t p_asset_file_id) {
+	Download *download = downloads.getptr(p_asset_file_id);
+	ERR_FAIL_NULL_MSG(download, vformat("MetaPlatformSDK: Asset file %s isn't in the download manager.", p_asset_file_id));
+	if (download->status != DOWNLOAD_PAUSED) {
+		return;
+	}
+	download->status = DOWNLOAD_QUEUED;
+	_start_next();
+}
+
+void MetaPlatformSDK_DownloadManager::cancel(uint64_t p_asset_file_id) {
+	Download *download = downloads.getptr(p_asset_file_id);
+	if (download == nullptr || download->status == DOWNLOAD_COMPLETED || download->status == DOWNLOAD_FAILED) {
+		return;
+	}
+
+	bool was_active = download->status == DOWNLOAD_ACTIVE;
+	if (was_active) {
+		_stop(p_asset_file_id);
+		MetaPlatformSDK::get_singleton()->asset_file_download_cancel_by_id_async(p_asset_file_id);
+	}
+	downloads.erase(p_asset_file_id);
+	progress_changed = true;
+	emit_signal("download_cancelled", p_asset_file_id);
+
+	if (was_active) {
+		_start_next();
+	}
+}
+
+void MetaPlatformSDK_DownloadManager::clear_finished() {
+	LocalVector<uint64_t> finished;
+	for (const KeyValue<uint64_t, Download> &E : downloads) {
+		if (E.value.status == DOWNLOAD_COMPLETED || E.value.status == DOWNLOAD_FAILED) {
+			finished.push_back(E.key);
+		}
+	}
+	for (uint64_t asset_file_id : finished) {
+		downloads.erase(asset_file_id);
+	}
+	progress_changed = progress_changed || !finished.is_empty();
+}
+
+bool MetaPlatformSDK_DownloadManager::has_download(uint64_t p_asset_file_id) const {
+	return downloads.has(p_asset_file_id);
+}
+
+MetaPlatformSDK_DownloadManager::DownloadStatus MetaPlatformSDK_DownloadManager::get_download_status(uint64_t p_asset_file_id) const {
+	const Download *download = downloads.getptr(p_asset_file_id);
+	ERR_FAIL_NULL_V_MSG(download, DOWNLOAD_FAILED, vformat("MetaPlatformSDK: Asset file %s isn't in the download manager.", p_asset_file_id));
+	return download->status;
+}
+
+Dictionary MetaPlatformSDK_DownloadManager::get_download(uint64_t p_asset_file_id) const {
+	Dictionary ret;
+	const Download *download = downloads.getptr(p_asset_file_id);
+	ERR_FAIL_NULL_V_MSG(download, ret, vformat("MetaPlatformSDK: Asset file %s isn't in the download manager.", p_asset_file_id));
+
+	ret["asset_file_id"] = p_asset_file_id;
+	ret["status"] = download->status;
+	ret["priority"] = download->priority;
+	ret["bytes_transferred"] = download->bytes_transferred;
+	ret["bytes_total"] = download->bytes_total;
+	ret["file_path"] = download->file_path;
+	ret["load_resource_pack"] = download->load_resource_pack;
+	return ret;
+}
+
+PackedInt64Array MetaPlatformSDK_DownloadManager::get_download_ids() const {
+	PackedInt64Array ids;
+	for (const KeyValue<uint64_t, Download> &E : downloads) {
+		ids.push_back(E.key);
+	}
+	return ids;
+}
+
+Dictionary MetaPlatformSDK_DownloadManager::get_progress() const {
+	int64_t bytes_transferred = 0;
+	int64_t bytes_total = 0;
+	int32_t counts[DOWNLOAD_FAILED + 1] = {};
+	for (const KeyValue<uint64_t, Download> &E : downloads) {
+		counts[E.value.status]++;
+		if (E.value.status != DOWNLOAD_FAILED) {
+			bytes_transferred += E.value.bytes_transferred;
+			bytes_total += E.value.bytes_total;
+		}
+	}
+
+	Dictionary ret;
+	ret["bytes_transferred"] = bytes_transferred;
+	ret["bytes_total"] = bytes_total;
+	ret["queued"] = counts[DOWNLOAD_QUEUED];
+	ret["active"] = counts[DOWNLOAD_ACTIVE];
+	ret["paused"] = counts[DOWNLOAD_PAUSED];
+	ret["completed"] = counts[DOWNLOAD_COMPLETED];
+	ret["failed"] = counts[DOWNLOAD_FAILED];
+	return ret;
+}
+
+MetaPlatformSDK_DownloadManager::MetaPlatformSDK_DownloadManager() {
+}
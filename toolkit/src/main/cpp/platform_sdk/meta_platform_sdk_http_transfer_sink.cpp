@@ -0,0 +1,146 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_http_transfer_sink.h"
+
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+// Standard CRC-32 (as used by zlib), so the checksum can be compared against the one published for the file.
+static const uint32_t *_get_crc32_table() {
+	static uint32_t table[256];
+	static bool initialized = false;
+	if (!initialized) {
+		for (uint32_t i = 0; i < 256; i++) {
+			uint32_t value = i;
+			for (int bit = 0; bit < 8; bit++) {
+				value = (value & 1) ? (0xEDB88320 ^ (value >> 1)) : (value >> 1);
+			}
+			table[i] = value;
+		}
+		initialized = true;
+	}
+	return table;
+}
+
+void MetaPlatformSDK_HttpTransferSink::_bind_methods() {
+	ClassDB::bind_static_method("MetaPlatformSDK_HttpTransferSink", D_METHOD("create_for_file", "path"), &MetaPlatformSDK_HttpTransferSink::create_for_file);
+	ClassDB::bind_static_method("MetaPlatformSDK_HttpTransferSink", D_METHOD("create_for_buffer", "buffer", "offset"), &MetaPlatformSDK_HttpTransferSink::create_for_buffer, DEFVAL(0));
+
+	ClassDB::bind_method(D_METHOD("get_transfer_id"), &MetaPlatformSDK_HttpTransferSink::get_transfer_id);
+	ClassDB::bind_method(D_METHOD("get_bytes_written"), &MetaPlatformSDK_HttpTransferSink::get_bytes_written);
+	ClassDB::bind_method(D_METHOD("get_checksum"), &MetaPlatformSDK_HttpTransferSink::get_checksum);
+	ClassDB::bind_method(D_METHOD("is_finished"), &MetaPlatformSDK_HttpTransferSink::is_finished);
+	ClassDB::bind_method(D_METHOD("set_idle_timeout", "seconds"), &MetaPlatformSDK_HttpTransferSink::set_idle_timeout);
+	ClassDB::bind_method(D_METHOD("get_idle_timeout"), &MetaPlatformSDK_HttpTransferSink::get_idle_timeout);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "transfer_id"), "", "get_transfer_id");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "bytes_written"), "", "get_bytes_written");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "checksum"), "", "get_checksum");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "finished"), "", "is_finished");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "idle_timeout", PROPERTY_HINT_RANGE, "0,300,0.1,or_greater,suffix:s"), "set_idle_timeout", "get_idle_timeout");
+
+	ADD_SIGNAL(MethodInfo("completed", PropertyInfo(Variant::INT, "total_size"), PropertyInfo(Variant::INT, "checksum")));
+	ADD_SIGNAL(MethodInfo("failed", PropertyInfo(Variant::STRING, "error")));
+}
+
+String MetaPlatformSDK_HttpTransferSink::_to_string() const {
+	return String("[MetaPlatformSDK_HttpTransferSink:") + itos(get_instance_id()) + String(" transfer_id=") + itos(transfer_id) + String(" bytes_written=") + itos(bytes_written) + String("]");
+}
+
+Ref<MetaPlatformSDK_HttpTransferSink> MetaPlatformSDK_HttpTransferSink::create_for_file(const String &p_path) {
+	Ref<FileAccess> file = FileAccess::open(p_path, FileAccess::WRITE);
+	ERR_FAIL_COND_V_MSG(file.is_null(), Ref<MetaPlatformSDK_HttpTransferSink>(), vformat("MetaPlatformSDK: Unable to open %s for writing: %s", p_path, FileAccess::get_open_error()));
+
+	Ref<MetaPlatformSDK_HttpTransferSink> sink;
+	sink.instantiate();
+	sink->path = p_path;
+	sink->file = file;
+	return sink;
+}
+
+Ref<MetaPlatformSDK_HttpTransferSink> MetaPlatformSDK_HttpTransferSink::create_for_buffer(const Ref<MetaPlatformSDK_ByteBuffer> &p_buffer, int64_t p_offset) {
+	ERR_FAIL_COND_V(p_buffer.is_null(), Ref<MetaPlatformSDK_HttpTransferSink>());
+	ERR_FAIL_COND_V(p_offset < 0, Ref<MetaPlatformSDK_HttpTransferSink>());
+
+	Ref<MetaPlatformSDK_HttpTransferSink> sink;
+	sink.instantiate();
+	sink->buffer = p_buffer;
+	sink->buffer_offset = p_offset;
+	return sink;
+}
+
+void MetaPlatformSDK_HttpTransferSink::set_idle_timeout(double p_seconds) {
+	ERR_FAIL_COND(p_seconds < 0.0);
+	idle_timeout = p_seconds;
+}
+
+void MetaPlatformSDK_HttpTransferSink::_set_transfer_id(uint64_t p_transfer_id) {
+	transfer_id = p_transfer_id;
+	last_update_usec = Time::get_singleton()->get_ticks_usec();
+}
+
+void MetaPlatformSDK_HttpTransferSink::_append(const void *p_data, size_t p_size) {
+	if (finished) {
+		return;
+	}
+	last_update_usec = Time::get_singleton()->get_ticks_usec();
+	if (p_data == nullptr || p_size == 0) {
+		return;
+	}
+
+	if (file.is_valid()) {
+		if ((size_t)file_chunk.size() != p_size) {
+			file_chunk.resize(p_size);
+		}
+		memcpy(file_chunk.ptrw(), p_data, p_size);
+		file->store_buffer(file_chunk);
+	} else if (buffer.is_valid()) {
+		buffer->_write(p_data, p_size, buffer_offset + bytes_written);
+	}
+
+	const uint32_t *table = _get_crc32_table();
+	const uint8_t *bytes = (const uint8_t *)p_data;
+	uint32_t value = crc;
+	for (size_t i = 0; i < p_size; i++) {
+		value = table[(value ^ bytes[i]) & 0xFF] ^ (value >> 8);
+	}
+	crc = value;
+
+	bytes_written += p_size;
+}
+
+void MetaPlatformSDK_HttpTransferSink::_finish() {
+	if (finished) {
+		return;
+	}
+	finished = true;
+	file_chunk = PackedByteArray();
+
+	if (file.is_valid()) {
+		file->flush();
+		Error err = file->get_error();
+		file.unref();
+		if (err != OK) {
+			emit_signal("failed", vformat("Unable to write to %s: %s", path, err));
+			return;
+		}
+	}
+	buffer.unref();
+
+	emit_signal("completed", bytes_written, get_checksum());
+}
+
+void MetaPlatformSDK_HttpTransferSink::_fail(const String &p_error) {
+	if (finished) {
+		return;
+	}
+	finished = true;
+	file_chunk = PackedByteArray();
+	file.unref();
+	buffer.unref();
+
+	emit_signal("failed", p_error);
+}
+
+MetaPlatformSDK_HttpTransferSink::MetaPlatformSDK_HttpTransferSink() {
+}
@@ -0,0 +1,92 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_latency_histogram.h"
+
+#include <godot_cpp/variant/packed_int64_array.hpp>
+
+void MetaPlatformSDKLatencyHistogram::record(uint64_t p_usec) {
+	uint32_t bucket = 0;
+	uint64_t bound = (uint64_t)1 << FIRST_BUCKET_SHIFT;
+	while (bucket < BUCKET_COUNT - 1 && p_usec >= bound) {
+		bucket++;
+		bound <<= 1;
+	}
+
+	buckets[bucket]++;
+	count++;
+	total_usec += p_usec;
+	if (p_usec > max_usec) {
+		max_usec = p_usec;
+	}
+}
+
+uint64_t MetaPlatformSDKLatencyHistogram::get_bucket_upper_bound_usec(uint32_t p_bucket) {
+	if (p_bucket >= BUCKET_COUNT - 1) {
+		return UINT64_MAX;
+	}
+	return (uint64_t)1 << (FIRST_BUCKET_SHIFT + p_bucket);
+}
+
+double MetaPlatformSDKLatencyHistogram::get_percentile_usec(double p_fraction) const {
+	if (count == 0) {
+		return 0.0;
+	}
+
+	double target = CLAMP(p_fraction, 0.0, 1.0) * (double)count;
+	uint64_t seen = 0;
+	for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+		if (buckets[i] == 0 || (double)(seen + buckets[i]) < target) {
+			seen += buckets[i];
+			continue;
+		}
+
+		// Assume the latencies are spread evenly within the bucket.
+		double lower = i == 0 ? 0.0 : (double)get_bucket_upper_bound_usec(i - 1);
+		double upper = MIN((double)get_bucket_upper_bound_usec(i), (double)max_usec);
+		if (upper < lower) {
+			return upper;
+		}
+		return lower + (upper - lower) * (target - (double)seen) / (double)buckets[i];
+	}
+
+	return (double)max_usec;
+}
+
+bool MetaPlatformSDKLatencyStats::record(int32_t p_message_type, uint64_t p_usec) {
+	MetaPlatformSDKLatencyHistogram *histogram = histograms.getptr(p_message_type);
+	if (histogram != nullptr) {
+		histogram->record(p_usec);
+		return false;
+	}
+
+	MetaPlatformSDKLatencyHistogram new_histogram;
+	new_histogram.record(p_usec);
+	histograms.insert(p_message_type, new_histogram);
+	return true;
+}
+
+const MetaPlatformSDKLatencyHistogram *MetaPlatformSDKLatencyStats::get(int32_t p_message_type) const {
+	return histograms.getptr(p_message_type);
+}
+
+Dictionary MetaPlatformSDKLatencyStats::histogram_to_dictionary(const MetaPlatformSDKLatencyHistogram &p_histogram) {
+	PackedInt64Array buckets;
+	buckets.resize(MetaPlatformSDKLatencyHistogram::BUCKET_COUNT);
+	for (uint32_t i = 0; i < MetaPlatformSDKLatencyHistogram::BUCKET_COUNT; i++) {
+		buckets[i] = p_histogram.buckets[i];
+	}
+
+	Dictionary stats;
+	stats["count"] = p_histogram.count;
+	stats["mean_msec"] = p_histogram.get_mean_usec() / 1000.0;
+	stats["p50_msec"] = p_histogram.get_percentile_usec(0.5) / 1000.0;
+	stats["p95_msec"] = p_histogram.get_percentile_usec(0.95) / 1000.0;
+	stats["p99_msec"] = p_histogram.get_percentile_usec(0.99) / 1000.0;
+	stats["max_msec"] = (double)p_histogram.max_usec / 1000.0;
+	stats["buckets"] = buckets;
+	return stats;
+}
+
+void MetaPlatformSDKLatencyStats::clear() {
+	histograms.clear();
+}
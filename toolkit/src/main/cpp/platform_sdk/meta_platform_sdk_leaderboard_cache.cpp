@@ -0,0 +1,374 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_leaderboard_cache.h"
+
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+#include "platform_sdk/meta_platform_sdk.h"
+#include "platform_sdk/meta_platform_sdk_leaderboard_entry_array.h"
+#include "platform_sdk/meta_platform_sdk_leaderboard_update_status.h"
+#include "platform_sdk/meta_platform_sdk_message.h"
+
+void MetaPlatformSDK_LeaderboardCache::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_ttl", "seconds"), &MetaPlatformSDK_LeaderboardCache::set_ttl);
+	ClassDB::bind_method(D_METHOD("get_ttl"), &MetaPlatformSDK_LeaderboardCache::get_ttl);
+	ClassDB::bind_method(D_METHOD("set_max_entries", "max_entries"), &MetaPlatformSDK_LeaderboardCache::set_max_entries);
+	ClassDB::bind_method(D_METHOD("get_max_entries"), &MetaPlatformSDK_LeaderboardCache::get_max_entries);
+	ClassDB::bind_method(D_METHOD("get_entries_async", "leaderboard_name", "start_rank", "count"), &MetaPlatformSDK_LeaderboardCache::get_entries_async);
+	ClassDB::bind_method(D_METHOD("get_entries_around_viewer_async", "leaderboard_name", "count"), &MetaPlatformSDK_LeaderboardCache::get_entries_around_viewer_async);
+	ClassDB::bind_method(D_METHOD("write_entry_async", "leaderboard_name", "score", "extra_data", "force_update"), &MetaPlatformSDK_LeaderboardCache::write_entry_async, DEFVAL(PackedByteArray()), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("invalidate", "leaderboard_name"), &MetaPlatformSDK_LeaderboardCache::invalidate);
+	ClassDB::bind_method(D_METHOD("clear"), &MetaPlatformSDK_LeaderboardCache::clear);
+	ClassDB::bind_method(D_METHOD("get_stats"), &MetaPlatformSDK_LeaderboardCache::get_stats);
+
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "ttl", PROPERTY_HINT_RANGE, "0,600,0.1,or_greater,suffix:s"), "set_ttl", "get_ttl");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_entries", PROPERTY_HINT_RANGE, "0,100000,1,or_greater"), "set_max_entries", "get_max_entries");
+}
+
+String MetaPlatformSDK_LeaderboardCache::_to_string() const {
+	return String("[MetaPlatformSDK_LeaderboardCache:") + itos(get_instance_id()) + String(" entries=") + itos(entry_count) + String("]");
+}
+
+void MetaPlatformSDK_LeaderboardCache::set_ttl(double p_seconds) {
+	ERR_FAIL_COND(p_seconds < 0.0);
+	ttl = p_seconds;
+}
+
+void MetaPlatformSDK_LeaderboardCache::set_max_entries(int32_t p_max_entries) {
+	ERR_FAIL_COND(p_max_entries < 0);
+	max_entries = p_max_entries;
+	_enforce_max_entries();
+}
+
+void MetaPlatformSDK_LeaderboardCache::_find_gaps(const Board &p_board, int64_t p_start_rank, int64_t p_count, uint64_t p_now_usec, LocalVector<Range> &r_gaps) const {
+	int64_t end = p_start_rank + p_count;
+	if (p_board.end_rank != 0 && _is_fresh(p_board.end_fetched_usec, p_now_usec)) {
+		end = MIN(end, p_board.end_rank);
+	}
+
+	Range gap;
+	for (int64_t rank = p_start_rank; rank < end; rank++) {
+		const CachedEntry *entry = p_board.entries.getptr(rank);
+		if (entry != nullptr && _is_fresh(entry->fetched_usec, p_now_usec)) {
+			if (gap.count > 0) {
+				r_gaps.push_back(gap);
+				gap = Range();
+			}
+			continue;
+		}
+		if (gap.count == 0) {
+			gap.start = rank;
+		}
+		gap.count++;
+	}
+	if (gap.count > 0) {
+		r_gaps.push_back(gap);
+	}
+}
+
+TypedArray<Dictionary> MetaPlatformSDK_LeaderboardCache::_collect(const Board &p_board, int64_t p_start_rank, int64_t p_count) {
+	TypedArray<Dictionary> rows;
+	for (int64_t rank = p_start_rank; rank < p_start_rank + p_count; rank++) {
+		const CachedEntry *entry = p_board.entries.getptr(rank);
+		if (entry != nullptr) {
+			rows.push_back(entry->row);
+		}
+	}
+	return rows;
+}
+
+int64_t MetaPlatformSDK_LeaderboardCache::_store_rows(Board &p_board, const Ref<MetaPlatformSDK_Message> &p_message, uint64_t p_now_usec, TypedArray<Dictionary> &r_rows, bool &r_has_next_page) {
+	r_has_next_page = false;
+	Ref<MetaPlatformSDK_LeaderboardEntryArray> array = p_message->get_data();
+	ERR_FAIL_COND_V(array.is_null(), 0);
+
+	r_rows = array->to_dictionary_array();
+	r_has_next_page = array->has_next_page();
+	int64_t last_rank = 0;
+	for (int i = 0; i < r_rows.size(); i++) {
+		Dictionary row = r_rows[i];
+		int64_t rank = row["rank"];
+
+		CachedEntry *existing = p_board.entries.getptr(rank);
+		if (existing != nullptr) {
+			existing->row = row;
+			existing->fetched_usec = p_now_usec;
+		} else {
+			CachedEntry entry;
+			entry.row = row;
+			entry.fetched_usec = p_now_usec;
+			p_board.entries.insert(rank, entry);
+			entry_count++;
+		}
+		last_rank = MAX(last_rank, rank);
+	}
+
+	return last_rank;
+}
+
+void MetaPlatformSDK_LeaderboardCache::_enforce_max_entries() {
+	if (entry_count <= (uint32_t)max_entries) {
+		return;
+	}
+
+	struct Candidate {
+		uint64_t fetched_usec;
+		int64_t rank;
+		Board *board;
+
+		bool operator<(const Candidate &p_other) const { return fetched_usec < p_other.fetched_usec; }
+	};
+
+	LocalVector<Candidate> candidates;
+	candidates.reserve(entry_count);
+	for (KeyValue<String, Board> &board : boards) {
+		for (const KeyValue<int64_t, CachedEntry> &entry : board.value.entries) {
+			candidates.push_back({ entry.value.fetched_usec, entry.key, &board.value });
+		}
+	}
+	candidates.sort();
+
+	// Evict the entries that were fetched the longest time ago.
+	uint32_t to_evict = entry_count - max_entries;
+	for (uint32_t i = 0; i < to_evict; i++) {
+		Board *board = candidates[i].board;
+		board->entries.erase(candidates[i].rank);
+		if (candidates[i].rank < board->end_rank) {
+			// We can no longer tell where the leaderboard ends.
+			board->end_rank = 0;
+		}
+	}
+	entry_count -= to_evict;
+	evictions += to_evict;
+}
+
+Ref<MetaPlatformSDK_LeaderboardWindow> MetaPlatformSDK_LeaderboardCache::get_entries_async(const String &p_leaderboard_name, int64_t p_start_rank, int64_t p_count) {
+	ERR_FAIL_COND_V(p_start_rank < 1, Ref<MetaPlatformSDK_LeaderboardWindow>());
+	ERR_FAIL_COND_V(p_count < 1, Ref<MetaPlatformSDK_LeaderboardWindow>());
+
+	Ref<MetaPlatformSDK_LeaderboardWindow> window;
+	window.instantiate();
+	window->leaderboard_name = p_leaderboard_name;
+	window->start_rank = p_start_rank;
+	window->count = p_count;
+
+	uint64_t now = Time::get_singleton()->get_ticks_usec();
+	Board &board = boards[p_leaderboard_name];
+
+	LocalVector<Range> gaps;
+	_find_gaps(board, p_start_rank, p_count, now, gaps);
+
+	int64_t missing = 0;
+	for (const Range &gap : gaps) {
+		missing += gap.count;
+	}
+	misses += missing;
+	hits += p_count - missing;
+
+	if (gaps.is_empty()) {
+		window->_complete(_collect(board, p_start_rank, p_count), true);
+		return window;
+	}
+
+	window->pending_ranges = gaps.size();
+	for (const Range &gap : gaps) {
+		if (!_request_range(window, gap.start, gap.count)) {
+			window->_fail(Ref<MetaPlatformSDK_Message>());
+			return window;
+		}
+	}
+
+	return window;
+}
+
+bool MetaPlatformSDK_LeaderboardCache::_request_range(const Ref<MetaPlatformSDK_LeaderboardWindow> &p_window, int64_t p_start_rank, int64_t p_count) {
+	Ref<MetaPlatformSDK_Request> request = MetaPlatformSDK::get_singleton()->leaderboard_get_entries_after_rank_async(p_window->leaderboard_name, p_count, p_start_rank - 1);
+	if (request.is_null()) {
+		return false;
+	}
+	request->then(callable_mp(this, &MetaPlatformSDK_LeaderboardCache::_on_range_fetched).bind(p_window, p_start_rank, p_count));
+	request->connect("timed_out", callable_mp(this, &MetaPlatformSDK_LeaderboardCache::_on_window_request_timed_out).bind(p_window));
+	request->connect("cancelled", callable_mp(this, &MetaPlatformSDK_LeaderboardCache::_on_window_request_timed_out).bind(p_window));
+	requests_issued++;
+	return true;
+}
+
+void MetaPlatformSDK_LeaderboardCache::_on_range_fetched(const Ref<MetaPlatformSDK_Message> &p_message, const Ref<MetaPlatformSDK_LeaderboardWindow> &p_window, int64_t p_start_rank, int64_t p_count) {
+	if (p_window->is_done()) {
+		return;
+	}
+	if (p_message->is_error()) {
+		p_window->_fail(p_message);
+		return;
+	}
+
+	uint64_t now = Time::get_singleton()->get_ticks_usec();
+	Board &board = boards[p_window->leaderboard_name];
+
+	TypedArray<Dictionary> rows;
+	bool has_next_page = false;
+	int64_t last_rank = _store_rows(board, p_message, now, rows, has_next_page);
+	if (has_next_page) {
+		// The server caps the page size, so there may be more of this range to fetch.
+		if (!rows.is_empty() && last_rank + 1 < p_start_rank + p_count) {
+			int64_t next_start_rank = last_rank + 1;
+			if (!_request_range(p_window, next_start_rank, p_start_rank + p_count - next_start_rank)) {
+				p_window->_fail(Ref<MetaPlatformSDK_Message>());
+			}
+			return;
+		}
+	} else if (rows.size() < p_count) {
+		// We've run off the end of the leaderboard.
+		board.end_rank = rows.is_empty() ? p_start_rank : last_rank + 1;
+		board.end_fetched_usec = now;
+	}
+
+	if (--p_window->pending_ranges > 0) {
+		return;
+	}
+
+	p_window->_complete(_collect(board, p_window->start_rank, p_window->count), false);
+	_enforce_max_entries();
+}
+
+Ref<MetaPlatformSDK_LeaderboardWindow> MetaPlatformSDK_LeaderboardCache::get_entries_around_viewer_async(const String &p_leaderboard_name, int64_t p_count) {
+	ERR_FAIL_COND_V(p_count < 1, Ref<MetaPlatformSDK_LeaderboardWindow>());
+
+	uint64_t now = Time::get_singleton()->get_ticks_usec();
+	Board &board = boards[p_leaderboard_name];
+
+	// Once we know where the viewer is, this is just another window.
+	if (board.viewer_rank != 0 && _is_fresh(board.viewer_fetched_usec, now)) {
+		return get_entries_async(p_leaderboard_name, MAX(1, board.viewer_rank - p_count / 2), p_count);
+	}
+
+	Ref<MetaPlatformSDK_LeaderboardWindow> window;
+	window.instantiate();
+	window->leaderboard_name = p_leaderboard_name;
+	window->count = p_count;
+
+	Ref<MetaPlatformSDK_Request> request = MetaPlatformSDK::get_singleton()->leaderboard_get_entries_async(p_leaderboard_name, p_count, MetaPlatformSDK::LEADERBOARD_FILTER_NONE, MetaPlatformSDK::LEADERBOARD_START_AT_CENTERED_ON_VIEWER);
+	if (request.is_null()) {
+		window->_fail(Ref<MetaPlatformSDK_Message>());
+		return window;
+	}
+	request->then(callable_mp(this, &MetaPlatformSDK_LeaderboardCache::_on_viewer_window_fetched).bind(window));
+	request->connect("timed_out", callable_mp(this, &MetaPlatformSDK_LeaderboardCache::_on_window_request_timed_out).bind(window));
+	request->connect("cancelled", callable_mp(this, &MetaPlatformSDK_LeaderboardCache::_on_window_request_timed_out).bind(window));
+	requests_issued++;
+	misses += p_count;
+
+	return window;
+}
+
+void MetaPlatformSDK_LeaderboardCache::_on_viewer_window_fetched(const Ref<MetaPlatformSDK_Message> &p_message, const Ref<MetaPlatformSDK_LeaderboardWindow> &p_window) {
+	if (p_window->is_done()) {
+		return;
+	}
+	if (p_message->is_error()) {
+		p_window->_fail(p_message);
+		return;
+	}
+
+	uint64_t now = Time::get_singleton()->get_ticks_usec();
+	Board &board = boards[p_window->leaderboard_name];
+
+	TypedArray<Dictionary> rows;
+	bool has_next_page = false;
+	_store_rows(board, p_message, now, rows, has_next_page);
+
+	uint64_t viewer_id = MetaPlatformSDK::get_singleton()->user_get_logged_in_user_id();
+	for (int i = 0; i < rows.size(); i++) {
+		Dictionary row = rows[i];
+		Variant user = row["user"];
+		if (user.get_type() == Variant::DICTIONARY && (uint64_t)((Dictionary)user)["id"] == viewer_id) {
+			board.viewer_rank = row["rank"];
+			board.viewer_fetched_usec = now;
+			break;
+		}
+	}
+
+	if (!rows.is_empty()) {
+		p_window->start_rank = ((Dictionary)rows[0])["rank"];
+	}
+	p_window->_complete(rows, false);
+	_enforce_max_entries();
+}
+
+void MetaPlatformSDK_LeaderboardCache::_on_window_request_timed_out(const Ref<MetaPlatformSDK_LeaderboardWindow> &p_window) {
+	// Any other requests for the window are left to finish, and fill in the cache.
+	p_window->_fail(Ref<MetaPlatformSDK_Message>());
+}
+
+Ref<MetaPlatformSDK_Request> MetaPlatformSDK_LeaderboardCache::write_entry_async(const String &p_leaderboard_name, int64_t p_score, const PackedByteArray &p_extra_data, bool p_force_update) {
+	Ref<MetaPlatformSDK_Request> request = MetaPlatformSDK::get_singleton()->leaderboard_write_entry_async(p_leaderboard_name, p_score, p_extra_data, p_force_update);
+	if (request.is_valid()) {
+		// Connected before the caller gets the request, so the cache is invalidated before their handlers run.
+		request->then(callable_mp(this, &MetaPlatformSDK_LeaderboardCache::_on_entry_written).bind(p_leaderboard_name, p_force_update));
+	}
+	return request;
+}
+
+void MetaPlatformSDK_LeaderboardCache::_on_entry_written(const Ref<MetaPlatformSDK_Message> &p_message, const String &p_leaderboard_name, bool p_force_update) {
+	if (p_message->is_error()) {
+		return;
+	}
+
+	Ref<MetaPlatformSDK_LeaderboardUpdateStatus> status = p_message->get_data();
+	if (status.is_valid() && !status->get_did_update()) {
+		return;
+	}
+
+	Board *board = boards.getptr(p_leaderboard_name);
+	if (board == nullptr) {
+		return;
+	}
+
+	if (board->viewer_rank == 0 || p_force_update) {
+		// We don't know where the viewer was, or a forced update may have lowered their score, so any rank could have moved.
+		invalidate(p_leaderboard_name);
+		return;
+	}
+
+	// Without a forced update, the viewer can only have moved up, so only the ranks from the top down to their old rank are affected.
+	LocalVector<int64_t> affected;
+	for (const KeyValue<int64_t, CachedEntry> &entry : board->entries) {
+		if (entry.key <= board->viewer_rank) {
+			affected.push_back(entry.key);
+		}
+	}
+	for (int64_t rank : affected) {
+		board->entries.erase(rank);
+	}
+	entry_count -= affected.size();
+	board->viewer_rank = 0;
+	board->viewer_fetched_usec = 0;
+}
+
+void MetaPlatformSDK_LeaderboardCache::invalidate(const String &p_leaderboard_name) {
+	Board *board = boards.getptr(p_leaderboard_name);
+	if (board == nullptr) {
+		return;
+	}
+	entry_count -= board->entries.size();
+	boards.erase(p_leaderboard_name);
+}
+
+void MetaPlatformSDK_LeaderboardCache::clear() {
+	boards.clear();
+	entry_count = 0;
+}
+
+Dictionary MetaPlatformSDK_LeaderboardCache::get_stats() const {
+	Dictionary stats;
+	stats["entries"] = entry_count;
+	stats["hits"] = hits;
+	stats["misses"] = misses;
+	stats["requests_issued"] = requests_issued;
+	stats["evictions"] = evictions;
+	return stats;
+}
+
+MetaPlatformSDK_LeaderboardCache::MetaPlatformSDK_LeaderboardCache() {
+}
@@ -0,0 +1,71 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_leaderboard_window.h"
+
+#include <godot_cpp/core/class_db.hpp>
+
+#include "platform_sdk/meta_platform_sdk_message.h"
+
+void MetaPlatformSDK_LeaderboardWindow::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("get_leaderboard_name"), &MetaPlatformSDK_LeaderboardWindow::get_leaderboard_name);
+	ClassDB::bind_method(D_METHOD("get_start_rank"), &MetaPlatformSDK_LeaderboardWindow::get_start_rank);
+	ClassDB::bind_method(D_METHOD("get_count"), &MetaPlatformSDK_LeaderboardWindow::get_count);
+	ClassDB::bind_method(D_METHOD("get_entries"), &MetaPlatformSDK_LeaderboardWindow::get_entries);
+	ClassDB::bind_method(D_METHOD("is_from_cache"), &MetaPlatformSDK_LeaderboardWindow::is_from_cache);
+	ClassDB::bind_method(D_METHOD("is_done"), &MetaPlatformSDK_LeaderboardWindow::is_done);
+
+	ADD_PROPERTY(PropertyInfo(Variant::STRING, "leaderboard_name"), "", "get_leaderboard_name");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "start_rank"), "", "get_start_rank");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "count"), "", "get_count");
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "entries", PROPERTY_HINT_ARRAY_TYPE, "Dictionary"), "", "get_entries");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "from_cache"), "", "is_from_cache");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "done"), "", "is_done");
+
+	ADD_SIGNAL(MethodInfo("completed", PropertyInfo(Variant::ARRAY, "entries", PROPERTY_HINT_ARRAY_TYPE, "Dictionary")));
+	ADD_SIGNAL(MethodInfo("failed", PropertyInfo(Variant::OBJECT, "message", PROPERTY_HINT_RESOURCE_TYPE, "MetaPlatformSDK_Message")));
+}
+
+String MetaPlatformSDK_LeaderboardWindow::_to_string() const {
+	return String("[MetaPlatformSDK_LeaderboardWindow:") + itos(get_instance_id()) + String(" leaderboard_name=") + leaderboard_name + String(" start_rank=") + itos(start_rank) + String(" count=") + itos(count) + String("]");
+}
+
+void MetaPlatformSDK_LeaderboardWindow::_complete(const TypedArray<Dictionary> &p_entries, bool p_from_cache) {
+	if (done) {
+		return;
+	}
+	done = true;
+	entries = p_entries;
+	from_cache = p_from_cache;
+
+	if (p_from_cache) {
+		// Nobody has had a chance to connect to the signal yet. Bind a reference, so we live until then.
+		callable_mp(this, &MetaPlatformSDK_LeaderboardWindow::_emit_completed).bind(Ref<MetaPlatformSDK_LeaderboardWindow>(this)).call_deferred();
+	} else {
+		emit_signal("completed", entries);
+	}
+}
+
+void MetaPlatformSDK_LeaderboardWindow::_fail(const Ref<MetaPlatformSDK_Message> &p_message) {
+	if (done) {
+		return;
+	}
+	done = true;
+
+	if (p_message.is_null()) {
+		// Either a request couldn't even be made, so nobody has had a chance to connect to the signal yet, or it timed out.
+		callable_mp(this, &MetaPlatformSDK_LeaderboardWindow::_emit_failed).bind(Ref<MetaPlatformSDK_LeaderboardWindow>(this)).call_deferred();
+	} else {
+		emit_signal("failed", p_message);
+	}
+}
+
+void MetaPlatformSDK_LeaderboardWindow::_emit_completed(const Ref<MetaPlatformSDK_LeaderboardWindow> &p_self) {
+	emit_signal("completed", entries);
+}
+
+void MetaPlatformSDK_LeaderboardWindow::_emit_failed(const Ref<MetaPlatformSDK_LeaderboardWindow> &p_self) {
+	emit_signal("failed", Ref<MetaPlatformSDK_Message>());
+}
+
+MetaPlatformSDK_LeaderboardWindow::MetaPlatformSDK_LeaderboardWindow() {
+}
@@ -0,0 +1,102 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_message_thread.h"
+
+#ifdef META_PLATFORM_SDK_ENABLED
+#include <OVR_Platform.h>
+
+#include "platform_sdk/meta_platform_sdk_message.h"
+
+void MetaPlatformSDKPendingMessage::free() {
+	if (message.is_valid()) {
+		message.unref();
+	} else {
+		ovr_FreeMessage(handle);
+	}
+	handle = nullptr;
+}
+
+MetaPlatformSDKPendingMessage MetaPlatformSDKPendingMessage::decode(ovrMessageHandle p_handle, bool p_decode_payload) {
+	MetaPlatformSDKPendingMessage pending;
+	pending.handle = p_handle;
+	pending.type = ovr_Message_GetType(p_handle);
+	pending.is_notification = ovrMessageType_IsNotification(pending.type);
+	if (!pending.is_notification) {
+		pending.request_id = ovr_Message_GetRequestID(p_handle);
+	}
+
+	// HTTP transfer updates may be handed straight to a sink, which takes the handle instead.
+	if (p_decode_payload && pending.type != ovrMessage_Notification_HTTP_Transfer) {
+		pending.message = MetaPlatformSDK_Message::_create_with_ovr_handle(p_handle, (MetaPlatformSDK::MessageType)pending.type, Variant());
+		pending.message->_predecode_data();
+		// Copy the payload out into plain structs too, so the getters don't read from the handle on the main
+		// thread. Pages keep their handle, which is needed to request the next one.
+		if (!pending.message->_has_next_page()) {
+			pending.message->_snapshot_data();
+		}
+	}
+	return pending;
+}
+
+void MetaPlatformSDKMessageThread::_thread_func() {
+	while (true) {
+		{
+			std::unique_lock<std::mutex> lock(wake_mutex);
+			wake_condition.wait_for(lock, std::chrono::microseconds(POLL_INTERVAL_USEC), [this] { return wake_pending || !is_running(); });
+			wake_pending = false;
+		}
+		if (!is_running()) {
+			break;
+		}
+
+		// Only pop what there's room for. The rest stays queued in the Platform SDK until the main thread catches up.
+		while (is_running() && !ring.is_full()) {
+			ovrMessageHandle handle = pop_message_func();
+			if (handle == nullptr) {
+				break;
+			}
+			ring.push(MetaPlatformSDKPendingMessage::decode(handle, true));
+		}
+	}
+}
+
+void MetaPlatformSDKMessageThread::start(PopMessageFunc p_pop_message_func, uint32_t p_capacity) {
+	ERR_FAIL_COND_MSG(is_running(), "MetaPlatformSDK: Message thread is already running.");
+	ERR_FAIL_NULL(p_pop_message_func);
+
+	pop_message_func = p_pop_message_func;
+	ring.resize(p_capacity);
+	// Take whatever is already waiting straight away.
+	wake_pending = true;
+	running.store(true, std::memory_order_release);
+	thread = std::thread(&MetaPlatformSDKMessageThread::_thread_func, this);
+}
+
+void MetaPlatformSDKMessageThread::stop() {
+	if (!thread.joinable()) {
+		return;
+	}
+	{
+		std::lock_guard<std::mutex> lock(wake_mutex);
+		running.store(false, std::memory_order_release);
+	}
+	wake_condition.notify_one();
+	thread.join();
+}
+
+void MetaPlatformSDKMessageThread::wake() {
+	{
+		std::lock_guard<std::mutex> lock(wake_mutex);
+		wake_pending = true;
+	}
+	wake_condition.notify_one();
+}
+
+bool MetaPlatformSDKMessageThread::pop(MetaPlatformSDKPendingMessage &r_message) {
+	return ring.pop(r_message);
+}
+
+MetaPlatformSDKMessageThread::~MetaPlatformSDKMessageThread() {
+	stop();
+}
+#endif // META_PLATFORM_SDK_ENABLED
@@ -0,0 +1,29 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_object_pool.h"
+
+// Constant initialized, so it's ready before any of the pools are constructed.
+MetaPlatformSDKObjectPoolBase *MetaPlatformSDKObjectPoolBase::first = nullptr;
+std::atomic<uint32_t> MetaPlatformSDKObjectPoolBase::max_size = { 0 };
+
+void MetaPlatformSDKObjectPoolBase::set_max_size(uint32_t p_max_size) {
+	max_size.store(p_max_size, std::memory_order_relaxed);
+	if (p_max_size == 0) {
+		clear_all();
+	}
+}
+
+void MetaPlatformSDKObjectPoolBase::sweep_all() {
+	if (get_max_size() == 0) {
+		return;
+	}
+	for (MetaPlatformSDKObjectPoolBase *pool = first; pool != nullptr; pool = pool->next) {
+		pool->_sweep();
+	}
+}
+
+void MetaPlatformSDKObjectPoolBase::clear_all() {
+	for (MetaPlatformSDKObjectPoolBase *pool = first; pool != nullptr; pool = pool->next) {
+		pool->_clear();
+	}
+}
@@ -0,0 +1,221 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_pager.h"
+
+#include <godot_cpp/core/class_db.hpp>
+
+#include "platform_sdk/meta_platform_sdk_message.h"
+
+void MetaPlatformSDK_Pager::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_max_pages", "max_pages"), &MetaPlatformSDK_Pager::set_max_pages);
+	ClassDB::bind_method(D_METHOD("get_max_pages"), &MetaPlatformSDK_Pager::get_max_pages);
+	ClassDB::bind_method(D_METHOD("set_merge_columns", "enable"), &MetaPlatformSDK_Pager::set_merge_columns);
+	ClassDB::bind_method(D_METHOD("is_merge_columns"), &MetaPlatformSDK_Pager::is_merge_columns);
+	ClassDB::bind_method(D_METHOD("set_page_callback", "callback"), &MetaPlatformSDK_Pager::set_page_callback);
+	ClassDB::bind_method(D_METHOD("get_page_callback"), &MetaPlatformSDK_Pager::get_page_callback);
+	ClassDB::bind_method(D_METHOD("get_pages_received"), &MetaPlatformSDK_Pager::get_pages_received);
+	ClassDB::bind_method(D_METHOD("is_running"), &MetaPlatformSDK_Pager::is_running);
+	ClassDB::bind_method(D_METHOD("start"), &MetaPlatformSDK_Pager::start);
+	ClassDB::bind_method(D_METHOD("cancel"), &MetaPlatformSDK_Pager::cancel);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_pages", PROPERTY_HINT_RANGE, "0,100,1,or_greater"), "set_max_pages", "get_max_pages");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "merge_columns"), "set_merge_columns", "is_merge_columns");
+	ADD_PROPERTY(PropertyInfo(Variant::CALLABLE, "page_callback"), "set_page_callback", "get_page_callback");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "pages_received"), "", "get_pages_received");
+	ADD_PROPERTY(PropertyInfo(Variant::BOOL, "running"), "", "is_running");
+
+	ADD_SIGNAL(MethodInfo("page_received", PropertyInfo(Variant::OBJECT, "page", PROPERTY_HINT_RESOURCE_TYPE, "RefCounted"), PropertyInfo(Variant::INT, "index")));
+	ADD_SIGNAL(MethodInfo("completed", PropertyInfo(Variant::DICTIONARY, "columns")));
+	ADD_SIGNAL(MethodInfo("failed", PropertyInfo(Variant::OBJECT, "message", PROPERTY_HINT_RESOURCE_TYPE, "MetaPlatformSDK_Message")));
+}
+
+String MetaPlatformSDK_Pager::_to_string() const {
+	return String("[MetaPlatformSDK_Pager:") + itos(get_instance_id()) + String(" pages_received=") + itos(pages_received) + String(" running=") + (running ? "true" : "false") + String("]");
+}
+
+Ref<MetaPlatformSDK_Pager> MetaPlatformSDK_Pager::_create(const Ref<MetaPlatformSDK_Message> &p_first_message, const PageFuncs *p_funcs) {
+	Ref<MetaPlatformSDK_Pager> pager;
+	pager.instantiate();
+	pager->first_message = p_first_message;
+	pager->funcs = p_funcs;
+	return pager;
+}
+
+void MetaPlatformSDK_Pager::set_max_pages(int32_t p_max_pages) {
+	ERR_FAIL_COND(p_max_pages < 0);
+	max_pages = p_max_pages;
+}
+
+void MetaPlatformSDK_Pager::set_merge_columns(bool p_enable) {
+	ERR_FAIL_COND_MSG(running, "Cannot change merge_columns while the pager is running.");
+	merge_columns = p_enable;
+}
+
+void MetaPlatformSDK_Pager::set_page_callback(const Callable &p_callback) {
+	page_callback = p_callback;
+}
+
+void MetaPlatformSDK_Pager::start() {
+	ERR_FAIL_NULL(funcs);
+	ERR_FAIL_COND_MSG(running, "MetaPlatformSDK_Pager is already running.");
+	ERR_FAIL_COND_MSG(first_message.is_null(), "MetaPlatformSDK_Pager can only be started once.");
+
+	running = true;
+	self = Ref<MetaPlatformSDK_Pager>(this);
+
+	Ref<MetaPlatformSDK_Message> message = first_message;
+	first_message.unref();
+	_handle_page(message);
+}
+
+void MetaPlatformSDK_Pager::cancel() {
+	if (!running) {
+		return;
+	}
+	// Taken first, so cancelling the request doesn't look like the page request failing.
+	Ref<MetaPlatformSDK_Request> request = _take_next_request();
+	if (request.is_valid()) {
+		request->cancel();
+	}
+	_stop();
+}
+
+void MetaPlatformSDK_Pager::_handle_page(const Ref<MetaPlatformSDK_Message> &p_message) {
+	if (p_message->is_error()) {
+		Ref<MetaPlatformSDK_Pager> keep_alive = self;
+		_stop();
+		emit_signal("failed", p_message);
+		return;
+	}
+
+	Ref<RefCounted> page = p_message->get_data();
+	ERR_FAIL_COND_MSG(page.is_null(), "MetaPlatformSDK_Pager received a message without a page.");
+	int32_t index = pages_received++;
+
+	// Request the next page before doing anything else with this one, so it's in flight while we process this page.
+	bool next_page_failed = false;
+	if (funcs->has_next_page(page.ptr()) && (max_pages == 0 || pages_received < max_pages)) {
+		next_request = funcs->request_next_page(page.ptr());
+		if (next_request.is_valid()) {
+			next_request->then(callable_mp(this, &MetaPlatformSDK_Pager::_on_next_page_completed));
+			next_request->connect("timed_out", callable_mp(this, &MetaPlatformSDK_Pager::_on_next_page_failed));
+			next_request->connect("cancelled", callable_mp(this, &MetaPlatformSDK_Pager::_on_next_page_failed));
+		} else {
+			// There are more pages, so stopping here would leave the result incomplete.
+			next_page_failed = true;
+		}
+	}
+
+	if (merge_columns) {
+		page_columns.push_back(funcs->to_columns(page.ptr()));
+	}
+
+	if (page_callback.is_valid()) {
+		page_callback.call(page, index);
+	}
+	emit_signal("page_received", page, index);
+
+	// The callbacks may have cancelled us.
+	if (running && next_page_failed) {
+		ERR_PRINT("MetaPlatformSDK_Pager: Unable to request the next page.");
+		Ref<MetaPlatformSDK_Pager> keep_alive = self;
+		_stop();
+		emit_signal("failed", Ref<MetaPlatformSDK_Message>());
+	} else if (running && next_request.is_null()) {
+		Dictionary columns = merge_columns ? _concat_columns(page_columns) : Dictionary();
+		Ref<MetaPlatformSDK_Pager> keep_alive = self;
+		_stop();
+		emit_signal("completed", columns);
+	}
+}
+
+void MetaPlatformSDK_Pager::_on_next_page_completed(const Ref<MetaPlatformSDK_Message> &p_message) {
+	_take_next_request();
+	if (!running) {
+		return;
+	}
+	_handle_page(p_message);
+}
+
+void MetaPlatformSDK_Pager::_on_next_page_failed() {
+	_take_next_request();
+	if (!running) {
+		return;
+	}
+	Ref<MetaPlatformSDK_Pager> keep_alive = self;
+	_stop();
+	emit_signal("failed", Ref<MetaPlatformSDK_Message>());
+}
+
+Ref<MetaPlatformSDK_Request> MetaPlatformSDK_Pager::_take_next_request() {
+	Ref<MetaPlatformSDK_Request> request = next_request;
+	next_request.unref();
+	if (request.is_valid()) {
+		Callable on_failed = callable_mp(this, &MetaPlatformSDK_Pager::_on_next_page_failed);
+		if (request->is_connected("timed_out", on_failed)) {
+			request->disconnect("timed_out", on_failed);
+		}
+		if (request->is_connected("cancelled", on_failed)) {
+			request->disconnect("cancelled", on_failed);
+		}
+	}
+	return request;
+}
+
+void MetaPlatformSDK_Pager::_stop() {
+	running = false;
+	_take_next_request();
+	page_columns.clear();
+	// This may free the pager, so it must be last.
+	self.unref();
+}
+
+Dictionary MetaPlatformSDK_Pager::_concat_columns(const LocalVector<Dictionary> &p_pages) {
+	Dictionary ret;
+	if (p_pages.is_empty()) {
+		return ret;
+	}
+
+#define CONCAT_PACKED_COLUMN(m_variant_type, m_type)          \
+	case Variant::m_variant_type: {                           \
+		m_type column;                                        \
+		for (const Dictionary &page : p_pages) {              \
+			column.append_array((m_type)page[key]);           \
+		}                                                     \
+		ret[key] = column;                                    \
+	} break;
+
+	Array keys = p_pages[0].keys();
+	for (int i = 0; i < keys.size(); i++) {
+		const Variant &key = keys[i];
+		switch (p_pages[0][key].get_type()) {
+			CONCAT_PACKED_COLUMN(PACKED_BYTE_ARRAY, PackedByteArray);
+			CONCAT_PACKED_COLUMN(PACKED_INT32_ARRAY, PackedInt32Array);
+			CONCAT_PACKED_COLUMN(PACKED_INT64_ARRAY, PackedInt64Array);
+			CONCAT_PACKED_COLUMN(PACKED_FLOAT32_ARRAY, PackedFloat32Array);
+			CONCAT_PACKED_COLUMN(PACKED_FLOAT64_ARRAY, PackedFloat64Array);
+			CONCAT_PACKED_COLUMN(PACKED_STRING_ARRAY, PackedStringArray);
+			case Variant::DICTIONARY: {
+				LocalVector<Dictionary> nested;
+				nested.reserve(p_pages.size());
+				for (const Dictionary &page : p_pages) {
+					nested.push_back(page[key]);
+				}
+				ret[key] = _concat_columns(nested);
+			} break;
+			default: {
+				ERR_PRINT(vformat("MetaPlatformSDK_Pager: Unable to merge column %s", key));
+			} break;
+		}
+	}
+
+#undef CONCAT_PACKED_COLUMN
+
+	return ret;
+}
+
+MetaPlatformSDK_Pager::MetaPlatformSDK_Pager() {
+}
+
+MetaPlatformSDK_Pager::~MetaPlatformSDK_Pager() {
+}
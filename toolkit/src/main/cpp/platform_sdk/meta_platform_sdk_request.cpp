@@ -4,10 +4,93 @@
 
 #include <godot_cpp/core/class_db.hpp>
 
+#include "platform_sdk/meta_platform_sdk.h"
+#include "platform_sdk/meta_platform_sdk_message.h"
+#include "platform_sdk/meta_platform_sdk_request_group.h"
+
 void MetaPlatformSDK_Request::_bind_methods() {
 	ClassDB::bind_method(D_METHOD("get_id"), &MetaPlatformSDK_Request::get_id);
+	ClassDB::bind_method(D_METHOD("get_status"), &MetaPlatformSDK_Request::get_status);
+	ClassDB::bind_method(D_METHOD("cancel"), &MetaPlatformSDK_Request::cancel);
+	ClassDB::bind_method(D_METHOD("set_timeout", "seconds"), &MetaPlatformSDK_Request::set_timeout);
+	ClassDB::bind_method(D_METHOD("then", "continuation"), &MetaPlatformSDK_Request::then);
 	ADD_SIGNAL(MethodInfo("completed", PropertyInfo(Variant::OBJECT, "message", PROPERTY_HINT_RESOURCE_TYPE, "MetaPlatformSDK_Message")));
+	ADD_SIGNAL(MethodInfo("timed_out"));
+	ADD_SIGNAL(MethodInfo("cancelled"));
+
+	BIND_ENUM_CONSTANT(STATUS_PENDING);
+	BIND_ENUM_CONSTANT(STATUS_COMPLETED);
+	BIND_ENUM_CONSTANT(STATUS_CANCELLED);
+	BIND_ENUM_CONSTANT(STATUS_TIMED_OUT);
+}
+
+void MetaPlatformSDK_Request::_finish(Status p_status, const Ref<MetaPlatformSDK_Message> &p_message) {
+	status = p_status;
+
+	// Taken first, so nothing is called twice if a handler makes this request finish again.
+	LocalVector<Callable> finished_continuations;
+	if (p_status == STATUS_COMPLETED) {
+		finished_continuations = continuations;
+	}
+	continuations.clear();
+	LocalVector<GroupSlot> finished_groups = groups;
+	groups.clear();
+
+	for (const Callable &continuation : finished_continuations) {
+		if (continuation.is_valid()) {
+			continuation.call(p_message);
+		}
+	}
+
+	if (p_status == STATUS_COMPLETED) {
+		emit_signal("completed", p_message);
+	} else if (p_status == STATUS_TIMED_OUT) {
+		emit_signal("timed_out");
+	} else if (p_status == STATUS_CANCELLED) {
+		emit_signal("cancelled");
+	}
+
+	for (const GroupSlot &slot : finished_groups) {
+		slot.group->_on_request_finished(slot.index, p_message);
+	}
+}
+
+void MetaPlatformSDK_Request::cancel() {
+	if (status != STATUS_PENDING) {
+		return;
+	}
+	status = STATUS_CANCELLED;
+#ifdef META_PLATFORM_SDK_ENABLED
+	MetaPlatformSDK::get_singleton()->_cancel_request(this);
+#endif // META_PLATFORM_SDK_ENABLED
+	_finish(STATUS_CANCELLED, Ref<MetaPlatformSDK_Message>());
+}
+
+Ref<MetaPlatformSDK_Request> MetaPlatformSDK_Request::set_timeout(double p_seconds) {
+	ERR_FAIL_COND_V(p_seconds < 0.0, Ref<MetaPlatformSDK_Request>(this));
+	ERR_FAIL_COND_V_MSG(status != STATUS_PENDING, Ref<MetaPlatformSDK_Request>(this), "Cannot set the timeout on a request that's no longer pending.");
+#ifdef META_PLATFORM_SDK_ENABLED
+	MetaPlatformSDK::get_singleton()->_set_request_timeout(this, p_seconds);
+#endif // META_PLATFORM_SDK_ENABLED
+	return Ref<MetaPlatformSDK_Request>(this);
+}
+
+Ref<MetaPlatformSDK_Request> MetaPlatformSDK_Request::then(const Callable &p_continuation) {
+	ERR_FAIL_COND_V(!p_continuation.is_valid(), Ref<MetaPlatformSDK_Request>(this));
+	ERR_FAIL_COND_V_MSG(status != STATUS_PENDING, Ref<MetaPlatformSDK_Request>(this), "Cannot add a continuation to a request that's no longer pending.");
+	continuations.push_back(p_continuation);
+	return Ref<MetaPlatformSDK_Request>(this);
+}
+
+void MetaPlatformSDK_Request::_add_to_group(const Ref<MetaPlatformSDK_RequestGroup> &p_group, uint32_t p_index) {
+	GroupSlot slot;
+	slot.group = p_group;
+	slot.index = p_index;
+	groups.push_back(slot);
 }
 
 MetaPlatformSDK_Request::MetaPlatformSDK_Request() {
 }
+
+MetaPlatformSDK_Request::~MetaPlatformSDK_Request() {
+}
@@ -0,0 +1,87 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_request_coalescer.h"
+
+Ref<MetaPlatformSDK_Request> MetaPlatformSDKRequestCoalescer::join(const String &p_api, const String &p_key) {
+	InFlight *request = in_flight.getptr(p_key);
+	if (request == nullptr) {
+		return Ref<MetaPlatformSDK_Request>();
+	}
+
+	Ref<MetaPlatformSDK_Request> follower;
+	follower.instantiate();
+#ifdef META_PLATFORM_SDK_ENABLED
+	follower->shared_id = request->id;
+#endif // META_PLATFORM_SDK_ENABLED
+	request->followers.push_back(follower);
+
+	uint64_t *saved = saved_by_api.getptr(p_api);
+	if (saved != nullptr) {
+		(*saved)++;
+	} else {
+		saved_by_api.insert(p_api, 1);
+	}
+
+	return follower;
+}
+
+void MetaPlatformSDKRequestCoalescer::track(const String &p_key, uint64_t p_id) {
+	if (p_id == 0) {
+		return;
+	}
+	InFlight request;
+	request.id = p_id;
+	in_flight.insert(p_key, request);
+	keys_by_id.insert(p_id, p_key);
+}
+
+void MetaPlatformSDKRequestCoalescer::take_followers(uint64_t p_id, LocalVector<Ref<MetaPlatformSDK_Request>> &r_followers) {
+	String *key = keys_by_id.getptr(p_id);
+	if (key == nullptr) {
+		return;
+	}
+
+	InFlight *request = in_flight.getptr(*key);
+	if (request != nullptr) {
+		for (const Ref<MetaPlatformSDK_Request> &follower : request->followers) {
+			// Followers that were cancelled don't want the response anymore.
+			if (follower->get_status() == MetaPlatformSDK_Request::STATUS_PENDING) {
+				r_followers.push_back(follower);
+			}
+		}
+		in_flight.erase(*key);
+	}
+	keys_by_id.erase(p_id);
+}
+
+void MetaPlatformSDKRequestCoalescer::forget_if_unshared(uint64_t p_id) {
+	String *key = keys_by_id.getptr(p_id);
+	if (key == nullptr) {
+		return;
+	}
+
+	InFlight *request = in_flight.getptr(*key);
+	if (request != nullptr) {
+		for (const Ref<MetaPlatformSDK_Request> &follower : request->followers) {
+			if (follower->get_status() == MetaPlatformSDK_Request::STATUS_PENDING) {
+				return;
+			}
+		}
+		in_flight.erase(*key);
+	}
+	keys_by_id.erase(p_id);
+}
+
+Dictionary MetaPlatformSDKRequestCoalescer::get_stats() const {
+	Dictionary stats;
+	for (const KeyValue<String, uint64_t> &saved : saved_by_api) {
+		stats[saved.key] = saved.value;
+	}
+	return stats;
+}
+
+void MetaPlatformSDKRequestCoalescer::clear() {
+	in_flight.clear();
+	keys_by_id.clear();
+	saved_by_api.clear();
+}
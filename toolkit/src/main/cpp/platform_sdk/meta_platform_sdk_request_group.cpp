@@ -0,0 +1,117 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_request_group.h"
+
+#include <godot_cpp/core/class_db.hpp>
+
+#include "platform_sdk/meta_platform_sdk_message.h"
+
+void MetaPlatformSDK_RequestGroup::_bind_methods() {
+	ClassDB::bind_static_method("MetaPlatformSDK_RequestGroup", D_METHOD("when_all", "requests"), &MetaPlatformSDK_RequestGroup::when_all);
+	ClassDB::bind_static_method("MetaPlatformSDK_RequestGroup", D_METHOD("when_any", "requests"), &MetaPlatformSDK_RequestGroup::when_any);
+
+	ClassDB::bind_method(D_METHOD("get_mode"), &MetaPlatformSDK_RequestGroup::get_mode);
+	ClassDB::bind_method(D_METHOD("get_requests"), &MetaPlatformSDK_RequestGroup::get_requests);
+	ClassDB::bind_method(D_METHOD("get_messages"), &MetaPlatformSDK_RequestGroup::get_messages);
+	ClassDB::bind_method(D_METHOD("get_first_completed_index"), &MetaPlatformSDK_RequestGroup::get_first_completed_index);
+	ClassDB::bind_method(D_METHOD("is_done"), &MetaPlatformSDK_RequestGroup::is_done);
+	ClassDB::bind_method(D_METHOD("then", "continuation"), &MetaPlatformSDK_RequestGroup::then);
+	ClassDB::bind_method(D_METHOD("cancel"), &MetaPlatformSDK_RequestGroup::cancel);
+
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "mode", PROPERTY_HINT_ENUM, "All,Any"), "", "get_mode");
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "requests", PROPERTY_HINT_ARRAY_TYPE, "MetaPlatformSDK_Request"), "", "get_requests");
+	ADD_PROPERTY(PropertyInfo(Variant::ARRAY, "messages"), "", "get_messages");
+
+	ADD_SIGNAL(MethodInfo("completed", PropertyInfo(Variant::ARRAY, "messages")));
+
+	BIND_ENUM_CONSTANT(MODE_ALL);
+	BIND_ENUM_CONSTANT(MODE_ANY);
+}
+
+Ref<MetaPlatformSDK_RequestGroup> MetaPlatformSDK_RequestGroup::_create(Mode p_mode, const TypedArray<MetaPlatformSDK_Request> &p_requests) {
+	Ref<MetaPlatformSDK_RequestGroup> group;
+	group.instantiate();
+	group->mode = p_mode;
+	group->requests = p_requests.duplicate();
+	group->messages.resize(p_requests.size());
+
+	for (int i = 0; i < p_requests.size(); i++) {
+		Ref<MetaPlatformSDK_Request> request = p_requests[i];
+		if (request.is_null() || request->get_status() != MetaPlatformSDK_Request::STATUS_PENDING) {
+			// Requests that can't complete anymore count as finished, without a message.
+			group->finished_count++;
+			continue;
+		}
+		request->_add_to_group(group, i);
+	}
+
+	if (group->finished_count == (uint32_t)p_requests.size()) {
+		// Deferred, so there's a chance to connect to the signal first.
+		callable_mp(group.ptr(), &MetaPlatformSDK_RequestGroup::_complete).call_deferred();
+	}
+
+	return group;
+}
+
+Ref<MetaPlatformSDK_RequestGroup> MetaPlatformSDK_RequestGroup::when_all(const TypedArray<MetaPlatformSDK_Request> &p_requests) {
+	return _create(MODE_ALL, p_requests);
+}
+
+Ref<MetaPlatformSDK_RequestGroup> MetaPlatformSDK_RequestGroup::when_any(const TypedArray<MetaPlatformSDK_Request> &p_requests) {
+	return _create(MODE_ANY, p_requests);
+}
+
+void MetaPlatformSDK_RequestGroup::_on_request_finished(uint32_t p_index, const Ref<MetaPlatformSDK_Message> &p_message) {
+	if (done) {
+		return;
+	}
+
+	messages[p_index] = p_message;
+	finished_count++;
+	if (p_message.is_valid() && first_completed_index < 0) {
+		first_completed_index = p_index;
+	}
+
+	// When waiting on any, requests that time out or are cancelled don't count, unless they all do.
+	if ((mode == MODE_ANY && p_message.is_valid()) || finished_count == (uint32_t)requests.size()) {
+		_complete();
+	}
+}
+
+void MetaPlatformSDK_RequestGroup::_complete() {
+	if (done) {
+		return;
+	}
+	done = true;
+
+	LocalVector<Callable> finished_continuations = continuations;
+	continuations.clear();
+	for (const Callable &continuation : finished_continuations) {
+		if (continuation.is_valid()) {
+			continuation.call(messages);
+		}
+	}
+
+	emit_signal("completed", messages);
+}
+
+Ref<MetaPlatformSDK_RequestGroup> MetaPlatformSDK_RequestGroup::then(const Callable &p_continuation) {
+	ERR_FAIL_COND_V(!p_continuation.is_valid(), Ref<MetaPlatformSDK_RequestGroup>(this));
+	ERR_FAIL_COND_V_MSG(done, Ref<MetaPlatformSDK_RequestGroup>(this), "Cannot add a continuation to a request group that's already done.");
+	continuations.push_back(p_continuation);
+	return Ref<MetaPlatformSDK_RequestGroup>(this);
+}
+
+void MetaPlatformSDK_RequestGroup::cancel() {
+	// Take a reference, since the requests may be all that's keeping this group alive.
+	Ref<MetaPlatformSDK_RequestGroup> self(this);
+	for (int i = 0; i < requests.size(); i++) {
+		Ref<MetaPlatformSDK_Request> request = requests[i];
+		if (request.is_valid()) {
+			request->cancel();
+		}
+	}
+}
+
+MetaPlatformSDK_RequestGroup::MetaPlatformSDK_RequestGroup() {
+}
@@ -0,0 +1,190 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_request_table.h"
+
+// Don't bother compacting tiny tables.
+static const uint32_t MIN_ERASED_TO_COMPACT = 32;
+
+int64_t MetaPlatformSDKRequestTable::_find_index(uint64_t p_id) const {
+	int64_t low = 0;
+	int64_t high = (int64_t)entries.size() - 1;
+
+	// Responses usually arrive in the order requests were made, so check the front first.
+	if (high >= 0 && entries[0].id == p_id) {
+		return entries[0].erased ? -1 : 0;
+	}
+
+	while (low <= high) {
+		int64_t middle = (low + high) / 2;
+		uint64_t id = entries[middle].id;
+		if (id < p_id) {
+			low = middle + 1;
+		} else if (id > p_id) {
+			high = middle - 1;
+		} else {
+			return entries[middle].erased ? -1 : middle;
+		}
+	}
+
+	return -1;
+}
+
+void MetaPlatformSDKRequestTable::_compact() {
+	uint32_t write = 0;
+	for (uint32_t read = 0; read < entries.size(); read++) {
+		if (entries[read].erased) {
+			continue;
+		}
+		if (write != read) {
+			entries[write] = entries[read];
+		}
+		write++;
+	}
+	entries.resize(write);
+	erased_count = 0;
+}
+
+void MetaPlatformSDKRequestTable::insert(uint64_t p_id, const Ref<MetaPlatformSDK_Request> &p_request, uint64_t p_issued_usec, uint64_t p_deadline_usec) {
+	Entry entry;
+	entry.id = p_id;
+	entry.request = p_request;
+	entry.issued_usec = p_issued_usec;
+	entry.deadline_usec = p_deadline_usec;
+
+	if (entries.is_empty() || entries[entries.size() - 1].id < p_id) {
+		entries.push_back(entry);
+	} else {
+		// Find the first entry with an id that isn't less than this one.
+		uint32_t low = 0;
+		uint32_t high = entries.size();
+		while (low < high) {
+			uint32_t middle = (low + high) / 2;
+			if (entries[middle].id < p_id) {
+				low = middle + 1;
+			} else {
+				high = middle;
+			}
+		}
+
+		if (entries[low].id == p_id) {
+			ERR_FAIL_COND_MSG(!entries[low].erased, vformat("MetaPlatformSDK: Request id %s is already in use", p_id));
+			entries[low] = entry;
+			erased_count--;
+		} else {
+			entries.insert(low, entry);
+		}
+	}
+
+	if (p_deadline_usec != 0 && p_deadline_usec < next_deadline_usec) {
+		next_deadline_usec = p_deadline_usec;
+	}
+}
+
+MetaPlatformSDKRequestTable::Entry *MetaPlatformSDKRequestTable::find(uint64_t p_id) {
+	int64_t index = _find_index(p_id);
+	if (index < 0) {
+		return nullptr;
+	}
+	return &entries[index];
+}
+
+void MetaPlatformSDKRequestTable::erase(uint64_t p_id) {
+	int64_t index = _find_index(p_id);
+	if (index < 0) {
+		return;
+	}
+
+	Entry &entry = entries[index];
+	if (entry.request.is_null()) {
+		ignored_count--;
+	}
+	entry.request.unref();
+	entry.erased = true;
+	erased_count++;
+
+	if (erased_count == entries.size()) {
+		entries.clear();
+		erased_count = 0;
+	} else if (erased_count >= MIN_ERASED_TO_COMPACT && erased_count * 2 > entries.size()) {
+		_compact();
+	}
+}
+
+void MetaPlatformSDKRequestTable::ignore(uint64_t p_id) {
+	Entry *entry = find(p_id);
+	if (entry == nullptr || entry->request.is_null()) {
+		return;
+	}
+	entry->request.unref();
+	entry->deadline_usec = 0;
+	ignored_count++;
+}
+
+void MetaPlatformSDKRequestTable::set_deadline(uint64_t p_id, uint64_t p_deadline_usec) {
+	Entry *entry = find(p_id);
+	if (entry == nullptr || entry->request.is_null()) {
+		return;
+	}
+	entry->deadline_usec = p_deadline_usec;
+	if (p_deadline_usec != 0 && p_deadline_usec < next_deadline_usec) {
+		next_deadline_usec = p_deadline_usec;
+	}
+}
+
+void MetaPlatformSDKRequestTable::collect_expired(uint64_t p_now_usec, LocalVector<Ref<MetaPlatformSDK_Request>> &r_expired) {
+	if (p_now_usec < next_deadline_usec) {
+		return;
+	}
+
+	next_deadline_usec = UINT64_MAX;
+	for (Entry &entry : entries) {
+		if (entry.erased || entry.request.is_null() || entry.deadline_usec == 0) {
+			continue;
+		}
+		if (entry.deadline_usec <= p_now_usec) {
+			r_expired.push_back(entry.request);
+			entry.request.unref();
+			entry.deadline_usec = 0;
+			ignored_count++;
+		} else if (entry.deadline_usec < next_deadline_usec) {
+			next_deadline_usec = entry.deadline_usec;
+		}
+	}
+}
+
+void MetaPlatformSDKRequestTable::collect_stale(uint64_t p_now_usec, uint64_t p_threshold_usec, LocalVector<Ref<MetaPlatformSDK_Request>> &r_stale) {
+	for (Entry &entry : entries) {
+		if (entry.erased || entry.request.is_null() || entry.stale_reported) {
+			continue;
+		}
+		// Entries are sorted by id, and so roughly by age, but not strictly enough to stop early.
+		if (p_now_usec - entry.issued_usec >= p_threshold_usec) {
+			entry.stale_reported = true;
+			r_stale.push_back(entry.request);
+		}
+	}
+}
+
+void MetaPlatformSDKRequestTable::purge_ignored(uint64_t p_now_usec, uint64_t p_max_age_usec) {
+	if (ignored_count == 0) {
+		return;
+	}
+
+	for (Entry &entry : entries) {
+		if (entry.erased || entry.request.is_valid()) {
+			continue;
+		}
+		if (p_now_usec - entry.issued_usec >= p_max_age_usec) {
+			entry.erased = true;
+			erased_count++;
+			ignored_count--;
+		}
+	}
+
+	if (erased_count == entries.size()) {
+		entries.clear();
+		erased_count = 0;
+	} else if (erased_count >= MIN_ERASED_TO_COMPACT && erased_count * 2 > entries.size()) {
+		_compact();
+	}
+}
@@ -0,0 +1,145 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_string_cache.h"
+
+#include <cstring>
+
+std::mutex MetaPlatformSDKStringCache::mutex;
+LocalVector<MetaPlatformSDKStringCache::ResultSlot> MetaPlatformSDKStringCache::results;
+LocalVector<MetaPlatformSDKStringCache::ArgumentSlot> MetaPlatformSDKStringCache::arguments;
+uint32_t MetaPlatformSDKStringCache::size = MetaPlatformSDKStringCache::DEFAULT_SIZE;
+MetaPlatformSDKStringCache::Stats MetaPlatformSDKStringCache::result_stats;
+MetaPlatformSDKStringCache::Stats MetaPlatformSDKStringCache::argument_stats;
+
+Dictionary MetaPlatformSDKStringCache::Stats::to_dictionary(uint32_t p_entries) const {
+	Dictionary stats;
+	stats["hits"] = hits;
+	stats["misses"] = misses;
+	stats["evictions"] = evictions;
+	stats["uncached"] = uncached;
+	stats["entries"] = p_entries;
+	return stats;
+}
+
+String MetaPlatformSDKStringCache::intern(const char *p_str) {
+	if (p_str == nullptr || p_str[0] == '\0') {
+		return String();
+	}
+
+	// Hash (djb2) and measure in one pass, giving up on strings that are too long to be worth it.
+	uint32_t hash = 5381;
+	uint32_t length = 0;
+	while (p_str[length] != '\0' && length <= MAX_LENGTH) {
+		hash = ((hash << 5) + hash) + (uint8_t)p_str[length];
+		length++;
+	}
+
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if (size == 0 || length > MAX_LENGTH) {
+		result_stats.uncached++;
+		lock.unlock();
+		return String(p_str);
+	}
+	if (results.size() != size) {
+		results.resize(size);
+	}
+
+	ResultSlot &slot = results[hash & (size - 1)];
+	if (slot.hash == hash && slot.bytes.size() == length && memcmp(slot.bytes.ptr(), p_str, length) == 0) {
+		result_stats.hits++;
+		return slot.string;
+	}
+
+	result_stats.misses++;
+	if (slot.bytes.size() > 0) {
+		result_stats.evictions++;
+	}
+	slot.hash = hash;
+	slot.bytes.resize(length);
+	memcpy(slot.bytes.ptr(), p_str, length);
+	slot.string = String(p_str);
+	return slot.string;
+}
+
+CharString MetaPlatformSDKStringCache::utf8(const String &p_string) {
+	bool cacheable = !p_string.is_empty() && p_string.length() <= (int64_t)MAX_LENGTH;
+	uint32_t hash = cacheable ? p_string.hash() : 0;
+
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if (size == 0 || !cacheable) {
+		argument_stats.uncached++;
+		lock.unlock();
+		return p_string.utf8();
+	}
+	if (arguments.size() != size) {
+		arguments.resize(size);
+	}
+
+	ArgumentSlot &slot = arguments[hash & (size - 1)];
+	if (slot.hash == hash && slot.string == p_string) {
+		argument_stats.hits++;
+		return slot.utf8;
+	}
+
+	argument_stats.misses++;
+	if (!slot.string.is_empty()) {
+		argument_stats.evictions++;
+	}
+	slot.hash = hash;
+	slot.string = p_string;
+	slot.utf8 = p_string.utf8();
+	return slot.utf8;
+}
+
+void MetaPlatformSDKStringCache::set_size(uint32_t p_size) {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	uint32_t new_size = 0;
+	if (p_size > 0) {
+		new_size = 1;
+		while (new_size < p_size) {
+			new_size <<= 1;
+		}
+	}
+	if (new_size == size) {
+		return;
+	}
+	size = new_size;
+	results.reset();
+	arguments.reset();
+}
+
+uint32_t MetaPlatformSDKStringCache::get_size() {
+	std::lock_guard<std::mutex> lock(mutex);
+	return size;
+}
+
+void MetaPlatformSDKStringCache::clear() {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	// Frees the memory too, since this is also called at shutdown, before the engine's allocator goes away.
+	results.reset();
+	arguments.reset();
+	result_stats = Stats();
+	argument_stats = Stats();
+}
+
+Dictionary MetaPlatformSDKStringCache::get_stats() {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	uint32_t result_entries = 0;
+	for (const ResultSlot &slot : results) {
+		result_entries += slot.bytes.size() > 0;
+	}
+	uint32_t argument_entries = 0;
+	for (const ArgumentSlot &slot : arguments) {
+		argument_entries += !slot.string.is_empty();
+	}
+
+	Dictionary stats;
+	stats["results"] = result_stats.to_dictionary(result_entries);
+	stats["arguments"] = argument_stats.to_dictionary(argument_entries);
+	return stats;
+}
@@ -0,0 +1,319 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_warm_start_cache.h"
+
+#include <godot_cpp/classes/dir_access.hpp>
+#include <godot_cpp/classes/file_access.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/class_db.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
+
+#include "platform_sdk/meta_platform_sdk.h"
+#include "platform_sdk/meta_platform_sdk_error.h"
+#include "platform_sdk/meta_platform_sdk_message.h"
+#include "platform_sdk/meta_platform_sdk_pager.h"
+
+void MetaPlatformSDK_WarmStartCache::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_path", "path"), &MetaPlatformSDK_WarmStartCache::set_path);
+	ClassDB::bind_method(D_METHOD("get_path"), &MetaPlatformSDK_WarmStartCache::get_path);
+	ClassDB::bind_method(D_METHOD("load"), &MetaPlatformSDK_WarmStartCache::load);
+	ClassDB::bind_method(D_METHOD("save"), &MetaPlatformSDK_WarmStartCache::save);
+	ClassDB::bind_method(D_METHOD("clear"), &MetaPlatformSDK_WarmStartCache::clear);
+	ClassDB::bind_method(D_METHOD("refresh"), &MetaPlatformSDK_WarmStartCache::refresh);
+	ClassDB::bind_method(D_METHOD("is_refreshing"), &MetaPlatformSDK_WarmStartCache::is_refreshing);
+	ClassDB::bind_method(D_METHOD("get_data", "section"), &MetaPlatformSDK_WarmStartCache::get_data);
+	ClassDB::bind_method(D_METHOD("has_data", "section"), &MetaPlatformSDK_WarmStartCache::has_data);
+	ClassDB::bind_method(D_METHOD("is_fresh", "section"), &MetaPlatformSDK_WarmStartCache::is_fresh);
+	ClassDB::bind_method(D_METHOD("get_updated_time", "section"), &MetaPlatformSDK_WarmStartCache::get_updated_time);
+
+	ADD_PROPERTY(PropertyInfo(Variant::STRING, "path", PROPERTY_HINT_FILE, "*.cache"), "set_path", "get_path");
+
+	ADD_SIGNAL(MethodInfo("section_changed", PropertyInfo(Variant::INT, "section"), PropertyInfo(Variant::NIL, "data", PROPERTY_HINT_NONE, "", PROPERTY_USAGE_NIL_IS_VARIANT)));
+	ADD_SIGNAL(MethodInfo("section_failed", PropertyInfo(Variant::INT, "section"), PropertyInfo(Variant::OBJECT, "message", PROPERTY_HINT_RESOURCE_TYPE, "MetaPlatformSDK_Message")));
+	ADD_SIGNAL(MethodInfo("refreshed"));
+
+	BIND_ENUM_CONSTANT(SECTION_LOGGED_IN_USER);
+	BIND_ENUM_CONSTANT(SECTION_ENTITLEMENT);
+	BIND_ENUM_CONSTANT(SECTION_ACHIEVEMENT_DEFINITIONS);
+	BIND_ENUM_CONSTANT(SECTION_ACHIEVEMENT_PROGRESS);
+	BIND_ENUM_CONSTANT(SECTION_VIEWER_PURCHASES);
+	BIND_ENUM_CONSTANT(SECTION_MAX);
+}
+
+String MetaPlatformSDK_WarmStartCache::_to_string() const {
+	return String("[MetaPlatformSDK_WarmStartCache:") + itos(get_instance_id()) + String(" path=") + path + String(" refreshing=") + (is_refreshing() ? "true" : "false") + String("]");
+}
+
+void MetaPlatformSDK_WarmStartCache::set_path(const String &p_path) {
+	ERR_FAIL_COND(p_path.is_empty());
+	path = p_path;
+}
+
+bool MetaPlatformSDK_WarmStartCache::load() {
+	if (!FileAccess::file_exists(path)) {
+		return false;
+	}
+
+	Ref<FileAccess> file = FileAccess::open(path, FileAccess::READ);
+	ERR_FAIL_COND_V_MSG(file.is_null(), false, vformat("MetaPlatformSDK: Unable to open %s for reading: %s", path, FileAccess::get_open_error()));
+
+	if (file->get_32() != FILE_MAGIC || file->get_32() != FILE_VERSION) {
+		// Written by another version, it'll be replaced on the next save.
+		return false;
+	}
+
+	uint64_t loaded_user_id = file->get_64();
+	uint32_t section_count = file->get_32();
+	Entry loaded[SECTION_MAX];
+	for (uint32_t i = 0; i < section_count; i++) {
+		uint32_t section = file->get_32();
+		int64_t updated_time = (int64_t)file->get_64();
+		uint32_t size = file->get_32();
+		PackedByteArray bytes = file->get_buffer(size);
+		ERR_FAIL_COND_V_MSG(section >= SECTION_MAX || bytes.size() != (int64_t)size, false, vformat("MetaPlatformSDK: Warm start cache %s is corrupt.", path));
+
+		loaded[section].data = UtilityFunctions::bytes_to_var(bytes);
+		loaded[section].updated_time = updated_time;
+		loaded[section].has_data = true;
+	}
+
+	user_id = loaded_user_id;
+	for (int i = 0; i < SECTION_MAX; i++) {
+		// Anything the Platform SDK has already answered is newer than what's on disk.
+		if (!sections[i].fresh) {
+			sections[i] = loaded[i];
+		}
+	}
+	return true;
+}
+
+Error MetaPlatformSDK_WarmStartCache::save() {
+	// Written to the side and then moved into place, so an interrupted save can't leave a partial file.
+	String temp_path = path + ".tmp";
+	{
+		Ref<FileAccess> file = FileAccess::open(temp_path, FileAccess::WRITE);
+		ERR_FAIL_COND_V_MSG(file.is_null(), FileAccess::get_open_error(), vformat("MetaPlatformSDK: Unable to open %s for writing: %s", temp_path, FileAccess::get_open_error()));
+
+		uint32_t section_count = 0;
+		for (int i = 0; i < SECTION_MAX; i++) {
+			if (sections[i].has_data) {
+				section_count++;
+			}
+		}
+
+		file->store_32(FILE_MAGIC);
+		file->store_32(FILE_VERSION);
+		file->store_64(user_id);
+		file->store_32(section_count);
+		for (int i = 0; i < SECTION_MAX; i++) {
+			if (!sections[i].has_data) {
+				continue;
+			}
+			PackedByteArray bytes = UtilityFunctions::var_to_bytes(sections[i].data);
+			file->store_32(i);
+			file->store_64((uint64_t)sections[i].updated_time);
+			file->store_32(bytes.size());
+			file->store_buffer(bytes);
+		}
+	}
+
+	Error err = DirAccess::rename_absolute(temp_path, path);
+	ERR_FAIL_COND_V_MSG(err != OK, err, vformat("MetaPlatformSDK: Unable to move %s to %s.", temp_path, path));
+	dirty = false;
+	return OK;
+}
+
+void MetaPlatformSDK_WarmStartCache::clear() {
+	for (int i = 0; i < SECTION_MAX; i++) {
+		sections[i] = Entry();
+	}
+	user_id = 0;
+	dirty = false;
+
+	if (FileAccess::file_exists(path)) {
+		DirAccess::remove_absolute(path);
+	}
+}
+
+void MetaPlatformSDK_WarmStartCache::refresh() {
+	ERR_FAIL_COND_MSG(is_refreshing(), "MetaPlatformSDK_WarmStartCache is already refreshing.");
+
+	MetaPlatformSDK *platform_sdk = MetaPlatformSDK::get_singleton();
+	self = Ref<MetaPlatformSDK_WarmStartCache>(this);
+	pending_refreshes = SECTION_MAX;
+
+	// The logged in user goes first, since its answer decides whether the rest of the cache belongs to someone else.
+	_start_refresh(SECTION_LOGGED_IN_USER, platform_sdk->user_get_logged_in_user_async(), callable_mp(this, &MetaPlatformSDK_WarmStartCache::_on_user_received));
+	_start_refresh(SECTION_ENTITLEMENT, platform_sdk->entitlement_get_is_viewer_entitled_async(), callable_mp(this, &MetaPlatformSDK_WarmStartCache::_on_entitlement_received));
+	_start_refresh(SECTION_ACHIEVEMENT_DEFINITIONS, platform_sdk->achievements_get_all_definitions_async(), callable_mp(this, &MetaPlatformSDK_WarmStartCache::_on_first_page_received).bind(SECTION_ACHIEVEMENT_DEFINITIONS));
+	_start_refresh(SECTION_ACHIEVEMENT_PROGRESS, platform_sdk->achievements_get_all_progress_async(), callable_mp(this, &MetaPlatformSDK_WarmStartCache::_on_first_page_received).bind(SECTION_ACHIEVEMENT_PROGRESS));
+	_start_refresh(SECTION_VIEWER_PURCHASES, platform_sdk->iap_get_viewer_purchases_async(), callable_mp(this, &MetaPlatformSDK_WarmStartCache::_on_first_page_received).bind(SECTION_VIEWER_PURCHASES));
+}
+
+void MetaPlatformSDK_WarmStartCache::_start_refresh(Section p_section, const Ref<MetaPlatformSDK_Request> &p_request, const Callable &p_on_completed) {
+	if (p_request.is_null()) {
+		// The request couldn't be made, for example, because the Platform SDK isn't initialized.
+		_section_failed(Ref<MetaPlatformSDK_Message>(), p_section);
+		return;
+	}
+	p_request->then(p_on_completed);
+	p_request->connect("timed_out", callable_mp(this, &MetaPlatformSDK_WarmStartCache::_on_request_failed).bind(p_section));
+	p_request->connect("cancelled", callable_mp(this, &MetaPlatformSDK_WarmStartCache::_on_request_failed).bind(p_section));
+}
+
+Dictionary MetaPlatformSDK_WarmStartCache::_object_to_dictionary(Object *p_object) {
+	Dictionary ret;
+	TypedArray<Dictionary> properties = p_object->get_property_list();
+	for (int i = 0; i < properties.size(); i++) {
+		Dictionary property = properties[i];
+		uint32_t usage = property["usage"];
+		String name = property["name"];
+		if ((usage & (PROPERTY_USAGE_CATEGORY | PROPERTY_USAGE_GROUP | PROPERTY_USAGE_SUBGROUP)) || name == "script") {
+			continue;
+		}
+
+		Variant value = p_object->get(name);
+		if (value.get_type() == Variant::OBJECT) {
+			Object *nested = value;
+			value = nested != nullptr ? Variant(_object_to_dictionary(nested)) : Variant();
+		}
+		ret[name] = value;
+	}
+	return ret;
+}
+
+void MetaPlatformSDK_WarmStartCache::_update_section(Section p_section, const Variant &p_data) {
+	Entry &entry = sections[p_section];
+	entry.fresh = true;
+	if (entry.has_data && entry.data == p_data) {
+		return;
+	}
+
+	entry.data = p_data;
+	entry.has_data = true;
+	entry.updated_time = (int64_t)Time::get_singleton()->get_unix_time_from_system();
+	dirty = true;
+	emit_signal("section_changed", p_section, p_data);
+}
+
+void MetaPlatformSDK_WarmStartCache::_section_failed(const Ref<MetaPlatformSDK_Message> &p_message, Section p_section) {
+	// Whatever was cached is still served, it just isn't fresh.
+	emit_signal("section_failed", p_section, p_message);
+	_section_done();
+}
+
+void MetaPlatformSDK_WarmStartCache::_section_done() {
+	pending_refreshes--;
+	if (pending_refreshes > 0) {
+		return;
+	}
+
+	if (dirty) {
+		save();
+	}
+	Ref<MetaPlatformSDK_WarmStartCache> keep_alive = self;
+	self.unref();
+	emit_signal("refreshed");
+}
+
+bool MetaPlatformSDK_WarmStartCache::_is_not_entitled_error(const Ref<MetaPlatformSDK_Message> &p_message) {
+	// Only an answer from the service itself says the user isn't entitled. Transport errors have no HTTP status,
+	// and server errors don't say anything about the user.
+	Ref<MetaPlatformSDK_Error> error = p_message->get_error();
+	if (error.is_null()) {
+		return false;
+	}
+	int32_t http_code = error->get_http_code();
+	return http_code >= 400 && http_code < 500;
+}
+
+void MetaPlatformSDK_WarmStartCache::_on_user_received(const Ref<MetaPlatformSDK_Message> &p_message) {
+	if (p_message->is_error()) {
+		_section_failed(p_message, SECTION_LOGGED_IN_USER);
+		return;
+	}
+
+	Object *user = p_message->get_data();
+	if (user == nullptr) {
+		ERR_PRINT("MetaPlatformSDK: The logged in user response has no user.");
+		_section_failed(p_message, SECTION_LOGGED_IN_USER);
+		return;
+	}
+	uint64_t new_user_id = user->get("id");
+	if (user_id != 0 && new_user_id != user_id) {
+		// Someone else has logged in, so nothing cached for the last user can be shown anymore.
+		for (int i = 0; i < SECTION_MAX; i++) {
+			if (sections[i].has_data && !sections[i].fresh) {
+				sections[i] = Entry();
+				dirty = true;
+				emit_signal("section_changed", i, Variant());
+			}
+		}
+	}
+	user_id = new_user_id;
+
+	_update_section(SECTION_LOGGED_IN_USER, _object_to_dictionary(user));
+	_section_done();
+}
+
+void MetaPlatformSDK_WarmStartCache::_on_entitlement_received(const Ref<MetaPlatformSDK_Message> &p_message) {
+	// The Platform SDK reports that the user isn't entitled with an error, but so is failing to reach the
+	// service, in which case what's cached is kept.
+	if (p_message->is_error() && !_is_not_entitled_error(p_message)) {
+		_section_failed(p_message, SECTION_ENTITLEMENT);
+		return;
+	}
+
+	_update_section(SECTION_ENTITLEMENT, p_message->is_success());
+	_section_done();
+}
+
+void MetaPlatformSDK_WarmStartCache::_on_first_page_received(const Ref<MetaPlatformSDK_Message> &p_message, Section p_section) {
+	if (p_message->is_error()) {
+		_section_failed(p_message, p_section);
+		return;
+	}
+
+	Ref<MetaPlatformSDK_Pager> pager = p_message->create_pager();
+	if (pager.is_null()) {
+		ERR_PRINT(vformat("MetaPlatformSDK: Unable to page through %s.", p_message->get_type_as_string()));
+		_section_failed(p_message, p_section);
+		return;
+	}
+	pager->set_merge_columns(true);
+	pager->connect("completed", callable_mp(this, &MetaPlatformSDK_WarmStartCache::_on_pages_completed).bind(p_section));
+	pager->connect("failed", callable_mp(this, &MetaPlatformSDK_WarmStartCache::_section_failed).bind(p_section));
+	pager->start();
+}
+
+void MetaPlatformSDK_WarmStartCache::_on_pages_completed(const Dictionary &p_columns, Section p_section) {
+	_update_section(p_section, p_columns);
+	_section_done();
+}
+
+void MetaPlatformSDK_WarmStartCache::_on_request_failed(Section p_section) {
+	_section_failed(Ref<MetaPlatformSDK_Message>(), p_section);
+}
+
+Variant MetaPlatformSDK_WarmStartCache::get_data(Section p_section) const {
+	ERR_FAIL_INDEX_V(p_section, SECTION_MAX, Variant());
+	return sections[p_section].data;
+}
+
+bool MetaPlatformSDK_WarmStartCache::has_data(Section p_section) const {
+	ERR_FAIL_INDEX_V(p_section, SECTION_MAX, false);
+	return sections[p_section].has_data;
+}
+
+bool MetaPlatformSDK_WarmStartCache::is_fresh(Section p_section) const {
+	ERR_FAIL_INDEX_V(p_section, SECTION_MAX, false);
+	return sections[p_section].fresh;
+}
+
+int64_t MetaPlatformSDK_WarmStartCache::get_updated_time(Section p_section) const {
+	ERR_FAIL_INDEX_V(p_section, SECTION_MAX, 0);
+	return sections[p_section].updated_time;
+}
+
+MetaPlatformSDK_WarmStartCache::MetaPlatformSDK_WarmStartCache() {
+}
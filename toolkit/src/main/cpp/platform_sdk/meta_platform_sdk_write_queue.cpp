@@ -0,0 +1,354 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk/meta_platform_sdk_write_queue.h"
+
+#include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/core/class_db.hpp>
+
+#include "platform_sdk/meta_platform_sdk.h"
+#include "platform_sdk/meta_platform_sdk_message.h"
+
+void MetaPlatformSDK_WriteQueue::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_flush_interval", "seconds"), &MetaPlatformSDK_WriteQueue::set_flush_interval);
+	ClassDB::bind_method(D_METHOD("get_flush_interval"), &MetaPlatformSDK_WriteQueue::get_flush_interval);
+	ClassDB::bind_method(D_METHOD("set_max_retries", "max_retries"), &MetaPlatformSDK_WriteQueue::set_max_retries);
+	ClassDB::bind_method(D_METHOD("get_max_retries"), &MetaPlatformSDK_WriteQueue::get_max_retries);
+	ClassDB::bind_method(D_METHOD("set_lower_score_is_better", "leaderboard_name", "enable"), &MetaPlatformSDK_WriteQueue::set_lower_score_is_better);
+	ClassDB::bind_method(D_METHOD("is_lower_score_is_better", "leaderboard_name"), &MetaPlatformSDK_WriteQueue::is_lower_score_is_better);
+	ClassDB::bind_method(D_METHOD("achievements_add_count", "name", "count"), &MetaPlatformSDK_WriteQueue::achievements_add_count);
+	ClassDB::bind_method(D_METHOD("achievements_add_fields", "name", "fields"), &MetaPlatformSDK_WriteQueue::achievements_add_fields);
+	ClassDB::bind_method(D_METHOD("leaderboard_write_entry", "leaderboard_name", "score", "extra_data", "force_update"), &MetaPlatformSDK_WriteQueue::leaderboard_write_entry, DEFVAL(PackedByteArray()), DEFVAL(false));
+	ClassDB::bind_method(D_METHOD("get_pending_count"), &MetaPlatformSDK_WriteQueue::get_pending_count);
+	ClassDB::bind_method(D_METHOD("flush"), &MetaPlatformSDK_WriteQueue::flush);
+	ClassDB::bind_method(D_METHOD("clear"), &MetaPlatformSDK_WriteQueue::clear);
+	ClassDB::bind_method(D_METHOD("get_stats"), &MetaPlatformSDK_WriteQueue::get_stats);
+
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "flush_interval", PROPERTY_HINT_RANGE, "0,300,0.1,or_greater,suffix:s"), "set_flush_interval", "get_flush_interval");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "max_retries", PROPERTY_HINT_RANGE, "0,10,1,or_greater"), "set_max_retries", "get_max_retries");
+
+	ADD_SIGNAL(MethodInfo("flushed", PropertyInfo(Variant::INT, "requests_issued")));
+	ADD_SIGNAL(MethodInfo("write_failed", PropertyInfo(Variant::STRING, "name"), PropertyInfo(Variant::OBJECT, "message", PROPERTY_HINT_RESOURCE_TYPE, "MetaPlatformSDK_Message")));
+}
+
+void MetaPlatformSDK_WriteQueue::_notification(int p_what) {
+	switch (p_what) {
+		case NOTIFICATION_READY: {
+			if (Engine::get_singleton()->is_editor_hint()) {
+				return;
+			}
+			last_flush_usec = Time::get_singleton()->get_ticks_usec();
+			set_process_internal(true);
+		} break;
+
+		case NOTIFICATION_INTERNAL_PROCESS: {
+			if (flush_interval <= 0.0 || get_pending_count() == 0) {
+				return;
+			}
+			uint64_t now = Time::get_singleton()->get_ticks_usec();
+			if (now - last_flush_usec >= (uint64_t)(flush_interval * 1000000.0)) {
+				flush();
+			}
+		} break;
+
+		// Don't hold on to writes when the app may never come back.
+		case NOTIFICATION_APPLICATION_PAUSED:
+		case NOTIFICATION_WM_CLOSE_REQUEST:
+		case NOTIFICATION_EXIT_TREE: {
+			if (!Engine::get_singleton()->is_editor_hint()) {
+				flush();
+			}
+		} break;
+	}
+}
+
+void MetaPlatformSDK_WriteQueue::set_flush_interval(double p_seconds) {
+	ERR_FAIL_COND(p_seconds < 0.0);
+	flush_interval = p_seconds;
+}
+
+void MetaPlatformSDK_WriteQueue::set_max_retries(int32_t p_max_retries) {
+	ERR_FAIL_COND(p_max_retries < 0);
+	max_retries = p_max_retries;
+}
+
+void MetaPlatformSDK_WriteQueue::set_lower_score_is_better(const String &p_leaderboard_name, bool p_enable) {
+	if (p_enable) {
+		lower_score_is_better.insert(p_leaderboard_name);
+	} else {
+		lower_score_is_better.erase(p_leaderboard_name);
+	}
+}
+
+bool MetaPlatformSDK_WriteQueue::is_lower_score_is_better(const String &p_leaderboard_name) const {
+	return lower_score_is_better.has(p_leaderboard_name);
+}
+
+String MetaPlatformSDK_WriteQueue::_merge_fields(const String &p_a, const String &p_b) {
+	// Fields are strings of '0' and '1', which may have different lengths.
+	const String &longer = p_a.length() >= p_b.length() ? p_a : p_b;
+	const String &shorter = p_a.length() >= p_b.length() ? p_b : p_a;
+
+	String merged = longer;
+	for (int i = 0; i < shorter.length(); i++) {
+		if (shorter[i] == '1') {
+			merged[i] = '1';
+		}
+	}
+	return merged;
+}
+
+bool MetaPlatformSDK_WriteQueue::_queue_count(const String &p_name, const PendingCount &p_count) {
+	PendingCount *pending = pending_counts.getptr(p_name);
+	if (pending == nullptr) {
+		pending_counts.insert(p_name, p_count);
+		return false;
+	}
+
+	pending->count += p_count.count;
+	// A merged write is only given up on when all of it has failed too often.
+	pending->retries = MIN(pending->retries, p_count.retries);
+	return true;
+}
+
+bool MetaPlatformSDK_WriteQueue::_queue_fields(const String &p_name, const PendingFields &p_fields) {
+	PendingFields *pending = pending_fields.getptr(p_name);
+	if (pending == nullptr) {
+		pending_fields.insert(p_name, p_fields);
+		return false;
+	}
+
+	pending->fields = _merge_fields(pending->fields, p_fields.fields);
+	pending->retries = MIN(pending->retries, p_fields.retries);
+	return true;
+}
+
+bool MetaPlatformSDK_WriteQueue::_queue_score(const String &p_leaderboard_name, const PendingScore &p_score) {
+	PendingScore *pending = pending_scores.getptr(p_leaderboard_name);
+	if (pending == nullptr) {
+		pending_scores.insert(p_leaderboard_name, p_score);
+		return false;
+	}
+
+	// A forced write replaces whatever came before it, so it wins even if it's worse. Otherwise,
+	// the server would only keep the best score anyway, and a forced write before it still stands.
+	if (p_score.force_update || _is_better_score(p_leaderboard_name, p_score.score, pending->score)) {
+		pending->score = p_score.score;
+		pending->extra_data = p_score.extra_data;
+	}
+	pending->force_update = pending->force_update || p_score.force_update;
+	pending->retries = MIN(pending->retries, p_score.retries);
+	return true;
+}
+
+void MetaPlatformSDK_WriteQueue::_requeue_score(const String &p_leaderboard_name, const PendingScore &p_score) {
+	PendingScore *pending = pending_scores.getptr(p_leaderboard_name);
+	if (pending == nullptr) {
+		pending_scores.insert(p_leaderboard_name, p_score);
+		return;
+	}
+
+	// The failed write came first, so it's the one that a forced pending write replaces.
+	if (!pending->force_update && _is_better_score(p_leaderboard_name, p_score.score, pending->score)) {
+		pending->score = p_score.score;
+		pending->extra_data = p_score.extra_data;
+	}
+	pending->force_update = pending->force_update || p_score.force_update;
+	pending->retries = MIN(pending->retries, p_score.retries);
+}
+
+void MetaPlatformSDK_WriteQueue::achievements_add_count(const String &p_name, uint64_t p_count) {
+	ERR_FAIL_COND(p_name.is_empty());
+	writes_queued++;
+
+	PendingCount count;
+	count.count = p_count;
+	if (_queue_count(p_name, count)) {
+		writes_merged++;
+	}
+}
+
+void MetaPlatformSDK_WriteQueue::achievements_add_fields(const String &p_name, const String &p_fields) {
+	ERR_FAIL_COND(p_name.is_empty());
+	writes_queued++;
+
+	PendingFields fields;
+	fields.fields = p_fields;
+	if (_queue_fields(p_name, fields)) {
+		writes_merged++;
+	}
+}
+
+void MetaPlatformSDK_WriteQueue::leaderboard_write_entry(const String &p_leaderboard_name, int64_t p_score, const PackedByteArray &p_extra_data, bool p_force_update) {
+	ERR_FAIL_COND(p_leaderboard_name.is_empty());
+	writes_queued++;
+
+	PendingScore score;
+	score.score = p_score;
+	score.extra_data = p_extra_data;
+	score.force_update = p_force_update;
+	if (_queue_score(p_leaderboard_name, score)) {
+		writes_merged++;
+	}
+}
+
+int32_t MetaPlatformSDK_WriteQueue::get_pending_count() const {
+	return pending_counts.size() + pending_fields.size() + pending_scores.size();
+}
+
+int32_t MetaPlatformSDK_WriteQueue::flush() {
+	last_flush_usec = Time::get_singleton()->get_ticks_usec();
+	if (get_pending_count() == 0) {
+		return 0;
+	}
+
+	MetaPlatformSDK *sdk = MetaPlatformSDK::get_singleton();
+	int32_t issued = 0;
+
+	// Take everything out first, since the requests may complete, or fail and be queued again, during the flush.
+	HashMap<String, PendingCount> counts = pending_counts;
+	HashMap<String, PendingFields> fields = pending_fields;
+	HashMap<String, PendingScore> scores = pending_scores;
+	pending_counts.clear();
+	pending_fields.clear();
+	pending_scores.clear();
+
+	for (const KeyValue<String, PendingCount> &E : counts) {
+		SentWrite write;
+		write.type = WRITE_COUNT;
+		write.name = E.key;
+		write.count = E.value;
+		if (_send(sdk->achievements_add_count_async(E.key, E.value.count), write)) {
+			issued++;
+		}
+	}
+
+	for (const KeyValue<String, PendingFields> &E : fields) {
+		SentWrite write;
+		write.type = WRITE_FIELDS;
+		write.name = E.key;
+		write.fields = E.value;
+		if (_send(sdk->achievements_add_fields_async(E.key, E.value.fields), write)) {
+			issued++;
+		}
+	}
+
+	for (const KeyValue<String, PendingScore> &E : scores) {
+		SentWrite write;
+		write.type = WRITE_SCORE;
+		write.name = E.key;
+		write.score = E.value;
+		if (_send(sdk->leaderboard_write_entry_async(E.key, E.value.score, E.value.extra_data, E.value.force_update), write)) {
+			issued++;
+		}
+	}
+
+	requests_issued += issued;
+	emit_signal("flushed", issued);
+	return issued;
+}
+
+bool MetaPlatformSDK_WriteQueue::_send(const Ref<MetaPlatformSDK_Request> &p_request, const SentWrite &p_write) {
+	if (p_request.is_null()) {
+		_write_failed(p_write, Ref<MetaPlatformSDK_Message>());
+		return false;
+	}
+
+	uint64_t write_id = next_sent_write_id++;
+	sent_writes.insert(write_id, p_write);
+	p_request->then(callable_mp(this, &MetaPlatformSDK_WriteQueue::_on_write_completed).bind(write_id));
+	p_request->connect("timed_out", callable_mp(this, &MetaPlatformSDK_WriteQueue::_on_write_timed_out).bind(write_id));
+	p_request->connect("cancelled", callable_mp(this, &MetaPlatformSDK_WriteQueue::_on_write_timed_out).bind(write_id));
+	return true;
+}
+
+void MetaPlatformSDK_WriteQueue::_write_failed(const SentWrite &p_write, const Ref<MetaPlatformSDK_Message> &p_message) {
+	requests_failed++;
+
+	uint32_t retries = 0;
+	switch (p_write.type) {
+		case WRITE_COUNT:
+			retries = p_write.count.retries;
+			break;
+		case WRITE_FIELDS:
+			retries = p_write.fields.retries;
+			break;
+		case WRITE_SCORE:
+			retries = p_write.score.retries;
+			break;
+	}
+	if (retries >= (uint32_t)max_retries) {
+		emit_signal("write_failed", p_write.name, p_message);
+		return;
+	}
+
+	// Queued again to go out with the next flush, merged with anything written since.
+	writes_retried++;
+	switch (p_write.type) {
+		case WRITE_COUNT: {
+			PendingCount count = p_write.count;
+			count.retries++;
+			_queue_count(p_write.name, count);
+		} break;
+		case WRITE_FIELDS: {
+			PendingFields fields = p_write.fields;
+			fields.retries++;
+			_queue_fields(p_write.name, fields);
+		} break;
+		case WRITE_SCORE: {
+			PendingScore score = p_write.score;
+			score.retries++;
+			_requeue_score(p_write.name, score);
+		} break;
+	}
+}
+
+void MetaPlatformSDK_WriteQueue::_on_write_completed(const Ref<MetaPlatformSDK_Message> &p_message, uint64_t p_write_id) {
+	SentWrite *write = sent_writes.getptr(p_write_id);
+	ERR_FAIL_NULL(write);
+	SentWrite sent = *write;
+	sent_writes.erase(p_write_id);
+
+	if (p_message->is_error()) {
+		_write_failed(sent, p_message);
+	}
+}
+
+void MetaPlatformSDK_WriteQueue::_on_write_timed_out(uint64_t p_write_id) {
+	SentWrite *write = sent_writes.getptr(p_write_id);
+	ERR_FAIL_NULL(write);
+	SentWrite sent = *write;
+	sent_writes.erase(p_write_id);
+
+	// The server may still have applied a write that timed out or was cancelled. Fields and scores
+	// can safely be written again, but a count would be added twice.
+	if (sent.type == WRITE_COUNT) {
+		requests_failed++;
+		emit_signal("write_failed", sent.name, Ref<MetaPlatformSDK_Message>());
+		return;
+	}
+
+	_write_failed(sent, Ref<MetaPlatformSDK_Message>());
+}
+
+void MetaPlatformSDK_WriteQueue::clear() {
+	pending_counts.clear();
+	pending_fields.clear();
+	pending_scores.clear();
+}
+
+Dictionary MetaPlatformSDK_WriteQueue::get_stats() const {
+	Dictionary stats;
+	stats["queued"] = writes_queued;
+	stats["merged"] = writes_merged;
+	stats["retried"] = writes_retried;
+	stats["issued"] = requests_issued;
+	stats["failed"] = requests_failed;
+	stats["pending"] = get_pending_count();
+	return stats;
+}
+
+MetaPlatformSDK_WriteQueue::MetaPlatformSDK_WriteQueue() {
+	// Writes should still go out while the game is paused.
+	set_process_mode(PROCESS_MODE_ALWAYS);
+}
@@ -0,0 +1,438 @@
+// Copyright (c) 2024-present Meta Platforms, Inc. and affiliates. All rights reserved.
+
+#include "platform_sdk_stub/meta_platform_sdk_stub.h"
+
+#ifdef META_PLATFORM_SDK_STUB
+#include <godot_cpp/core/class_db.hpp>
+
+#include <algorithm>
+#include <chrono>
+
+// Don't let a long hitch turn the notification load into an unbounded burst.
+static const int32_t MAX_LOAD_BURST = 10000;
+
+/*
+ * MetaPlatformSDKStubObject
+ */
+
+Variant MetaPlatformSDKStubObject::get_field(const char *p_field) const {
+	if (p_field == nullptr) {
+		return value;
+	}
+	if (value.get_type() != Variant::DICTIONARY) {
+		return Variant();
+	}
+	Dictionary dict = value;
+	return dict.get(String(p_field), Variant());
+}
+
+void MetaPlatformSDKStubObject::set_field(const String &p_field, const Variant &p_value) {
+	if (value.get_type() != Variant::DICTIONARY) {
+		value = Dictionary();
+	}
+	Dictionary dict = value;
+	dict[p_field] = p_value;
+
+	strings.erase(p_field);
+	bytes.erase(p_field);
+	MetaPlatformSDKStubObject **child = children.getptr(p_field);
+	if (child != nullptr) {
+		memdelete(*child);
+		children.erase(p_field);
+	}
+}
+
+void MetaPlatformSDKStubObject::reset(const Variant &p_value) {
+	for (const KeyValue<String, MetaPlatformSDKStubObject *> &E : children) {
+		memdelete(E.value);
+	}
+	for (MetaPlatformSDKStubObject *element : elements) {
+		memdelete(element);
+	}
+	children.clear();
+	elements.clear();
+	strings.clear();
+	bytes.clear();
+	has_elements = false;
+	value = p_value;
+}
+
+const char *MetaPlatformSDKStubObject::get_string(const char *p_field) {
+	Variant field = get_field(p_field);
+	if (field.get_type() == Variant::NIL) {
+		return "";
+	}
+
+	String key = p_field != nullptr ? String(p_field) : String();
+	CharString *cached = strings.getptr(key);
+	if (cached == nullptr) {
+		cached = &strings.insert(key, field.stringify().utf8())->value;
+	}
+	return cached->get_data();
+}
+
+const void *MetaPlatformSDKStubObject::get_bytes(const char *p_field) {
+	Variant field = get_field(p_field);
+	if (field.get_type() != Variant::PACKED_BYTE_ARRAY) {
+		return nullptr;
+	}
+
+	String key = p_field != nullptr ? String(p_field) : String();
+	PackedByteArray *cached = bytes.getptr(key);
+	if (cached == nullptr) {
+		cached = &bytes.insert(key, field)->value;
+	}
+	return cached->ptr();
+}
+
+MetaPlatformSDKStubObject *MetaPlatformSDKStubObject::get_child(const char *p_field) {
+	String key = String(p_field);
+	MetaPlatformSDKStubObject **cached = children.getptr(key);
+	if (cached != nullptr) {
+		return *cached;
+	}
+
+	Variant field = get_field(p_field);
+	if (field.get_type() != Variant::DICTIONARY && field.get_type() != Variant::ARRAY) {
+		return nullptr;
+	}
+
+	MetaPlatformSDKStubObject *child = memnew(MetaPlatformSDKStubObject(field));
+	children.insert(key, child);
+	return child;
+}
+
+uint64_t MetaPlatformSDKStubObject::get_size() {
+	if (value.get_type() == Variant::ARRAY) {
+		return Array(value).size();
+	}
+	Variant field = get_field("Elements");
+	if (field.get_type() == Variant::ARRAY) {
+		return Array(field).size();
+	}
+	return 0;
+}
+
+MetaPlatformSDKStubObject *MetaPlatformSDKStubObject::get_element(uint64_t p_index) {
+	if (!has_elements) {
+		has_elements = true;
+		Array array = value.get_type() == Variant::ARRAY ? (Array)value : (Array)get_field("Elements");
+		elements.resize(array.size());
+		for (int64_t i = 0; i < array.size(); i++) {
+			elements[i] = memnew(MetaPlatformSDKStubObject(array[i]));
+		}
+	}
+	ERR_FAIL_UNSIGNED_INDEX_V(p_index, elements.size(), nullptr);
+	return elements[p_index];
+}
+
+MetaPlatformSDKStubObject *MetaPlatformSDKStubObject::from_handle(const void *p_handle) {
+	if (p_handle == nullptr) {
+		return MetaPlatformSDK_Stub::get_singleton()->_get_empty_object();
+	}
+	return (MetaPlatformSDKStubObject *)p_handle;
+}
+
+MetaPlatformSDKStubObject::~MetaPlatformSDKStubObject() {
+	reset();
+}
+
+/*
+ * MetaPlatformSDK_Stub
+ */
+
+MetaPlatformSDK_Stub *MetaPlatformSDK_Stub::singleton = nullptr;
+
+MetaPlatformSDK_Stub *MetaPlatformSDK_Stub::get_singleton() {
+	if (singleton == nullptr) {
+		singleton = memnew(MetaPlatformSDK_Stub());
+	}
+	return singleton;
+}
+
+void MetaPlatformSDK_Stub::_bind_methods() {
+	ClassDB::bind_method(D_METHOD("set_latency", "seconds"), &MetaPlatformSDK_Stub::set_latency);
+	ClassDB::bind_method(D_METHOD("get_latency"), &MetaPlatformSDK_Stub::get_latency);
+	ClassDB::bind_method(D_METHOD("set_jitter", "seconds"), &MetaPlatformSDK_Stub::set_jitter);
+	ClassDB::bind_method(D_METHOD("get_jitter"), &MetaPlatformSDK_Stub::get_jitter);
+	ClassDB::bind_method(D_METHOD("set_seed", "seed"), &MetaPlatformSDK_Stub::set_seed);
+	ClassDB::bind_method(D_METHOD("get_seed"), &MetaPlatformSDK_Stub::get_seed);
+	ClassDB::bind_method(D_METHOD("set_response", "message_type", "response"), &MetaPlatformSDK_Stub::set_response);
+	ClassDB::bind_method(D_METHOD("clear_responses"), &MetaPlatformSDK_Stub::clear_responses);
+	ClassDB::bind_method(D_METHOD("set_global", "field", "value"), &MetaPlatformSDK_Stub::set_global);
+	ClassDB::bind_method(D_METHOD("push_notification", "message_type", "data", "count"), &MetaPlatformSDK_Stub::push_notification, DEFVAL(Variant()), DEFVAL(1));
+	ClassDB::bind_method(D_METHOD("set_notification_load", "message_type", "rate", "data"), &MetaPlatformSDK_Stub::set_notification_load, DEFVAL(Variant()));
+	ClassDB::bind_method(D_METHOD("get_pending_message_count"), &MetaPlatformSDK_Stub::get_pending_message_count);
+	ClassDB::bind_method(D_METHOD("get_stats"), &MetaPlatformSDK_Stub::get_stats);
+	ClassDB::bind_method(D_METHOD("reset"), &MetaPlatformSDK_Stub::reset);
+
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "latency", PROPERTY_HINT_RANGE, "0,10,0.001,or_greater,suffix:s"), "set_latency", "get_latency");
+	ADD_PROPERTY(PropertyInfo(Variant::FLOAT, "jitter", PROPERTY_HINT_RANGE, "0,10,0.001,or_greater,suffix:s"), "set_jitter", "get_jitter");
+	ADD_PROPERTY(PropertyInfo(Variant::INT, "seed"), "set_seed", "get_seed");
+}
+
+uint64_t MetaPlatformSDK_Stub::_get_ticks_usec() {
+	// Not Time, since this is also called from the message thread.
+	return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+double MetaPlatformSDK_Stub::_randf() {
+	// xorshift64*, so runs with the same seed get the same delays.
+	rng_state ^= rng_state >> 12;
+	rng_state ^= rng_state << 25;
+	rng_state ^= rng_state >> 27;
+	return (double)((rng_state * 0x2545F4914F6CDD1DULL) >> 11) / (double)(1ULL << 53);
+}
+
+uint64_t MetaPlatformSDK_Stub::_get_delay_usec(double p_latency, double p_jitter) {
+	double delay = p_latency;
+	if (p_jitter > 0.0) {
+		delay += p_jitter * _randf();
+	}
+	return (uint64_t)(delay * 1000000.0);
+}
+
+static bool _is_delivered_before(const MetaPlatformSDKStubMessage *p_a, const MetaPlatformSDKStubMessage *p_b) {
+	if (p_a->deliver_usec != p_b->deliver_usec) {
+		return p_a->deliver_usec < p_b->deliver_usec;
+	}
+	return p_a->sequence < p_b->sequence;
+}
+
+static bool _is_delivered_after(const MetaPlatformSDKStubMessage *p_a, const MetaPlatformSDKStubMessage *p_b) {
+	return _is_delivered_before(p_b, p_a);
+}
+
+void MetaPlatformSDK_Stub::_push(MetaPlatformSDKStubMessage *p_message) {
+	p_message->sequence = next_sequence++;
+	pending.push_back(p_message);
+	std::push_heap(pending.ptr(), pending.ptr() + pending.size(), _is_delivered_after);
+}
+
+MetaPlatformSDKStubMessage *MetaPlatformSDK_Stub::_make_message(ovrMessageType p_type, const Variant &p_data, const Dictionary &p_error) {
+	MetaPlatformSDKStubMessage *message = memnew(MetaPlatformSDKStubMessage);
+	message->type = p_type;
+	message->payload.value = p_data;
+	if (!p_error.is_empty()) {
+		message->is_error = true;
+		message->error.value = p_error;
+	}
+	return message;
+}
+
+void MetaPlatformSDK_Stub::_generate_load(uint64_t p_now_usec) {
+	double elapsed = (double)(p_now_usec - last_load_usec) / 1000000.0;
+	last_load_usec = p_now_usec;
+
+	for (NotificationLoad &load : notification_loads) {
+		load.carry += load.rate * elapsed;
+		int32_t count = MIN((int32_t)load.carry, MAX_LOAD_BURST);
+		load.carry -= (int64_t)load.carry;
+
+		for (int32_t i = 0; i < count; i++) {
+			MetaPlatformSDKStubMessage *message = _make_message(load.type, load.data, Dictionary());
+			message->deliver_usec = p_now_usec;
+			_push(message);
+		}
+		notifications_made += count;
+	}
+}
+
+ovrRequest MetaPlatformSDK_Stub::_request(ovrMessageType p_type) {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	const Response *response = responses.getptr((int32_t)p_type);
+	MetaPlatformSDKStubMessage *message;
+	if (response != nullptr) {
+		message = _make_message(p_type, response->data, response->error);
+		message->deliver_usec = _get_ticks_usec() + _get_delay_usec(response->latency >= 0.0 ? response->latency : latency, response->jitter >= 0.0 ? response->jitter : jitter);
+	} else {
+		message = _make_message(p_type, Variant(), Dictionary());
+		message->deliver_usec = _get_ticks_usec() + _get_delay_usec(latency, jitter);
+	}
+	message->request_id = ++last_request_id;
+	_push(message);
+
+	requests_made++;
+	return message->request_id;
+}
+
+ovrMessageHandle MetaPlatformSDK_Stub::_pop_message() {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	uint64_t now = _get_ticks_usec();
+	if (!notification_loads.is_empty()) {
+		_generate_load(now);
+	}
+
+	if (pending.is_empty() || pending[0]->deliver_usec > now) {
+		return nullptr;
+	}
+
+	std::pop_heap(pending.ptr(), pending.ptr() + pending.size(), _is_delivered_after);
+	MetaPlatformSDKStubMessage *message = pending[pending.size() - 1];
+	pending.resize(pending.size() - 1);
+
+	messages_popped++;
+	return (ovrMessageHandle)message;
+}
+
+void MetaPlatformSDK_Stub::_free_message(ovrMessageHandle p_message) {
+	if (p_message == nullptr) {
+		return;
+	}
+	memdelete((MetaPlatformSDKStubMessage *)p_message);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	messages_freed++;
+}
+
+ovrPlatformInitializeResult MetaPlatformSDK_Stub::initialize(const String &p_app_id) {
+	initialized = true;
+	return ovrPlatformInitialize_Success;
+}
+
+ovrRequest MetaPlatformSDK_Stub::initialize_async(const String &p_app_id) {
+	initialized = true;
+	return _request(ovrMessage_PlatformInitializeAndroidAsynchronous);
+}
+
+void MetaPlatformSDK_Stub::set_latency(double p_seconds) {
+	ERR_FAIL_COND(p_seconds < 0.0);
+	std::lock_guard<std::mutex> lock(mutex);
+	latency = p_seconds;
+}
+
+double MetaPlatformSDK_Stub::get_latency() const {
+	return latency;
+}
+
+void MetaPlatformSDK_Stub::set_jitter(double p_seconds) {
+	ERR_FAIL_COND(p_seconds < 0.0);
+	std::lock_guard<std::mutex> lock(mutex);
+	jitter = p_seconds;
+}
+
+double MetaPlatformSDK_Stub::get_jitter() const {
+	return jitter;
+}
+
+void MetaPlatformSDK_Stub::set_seed(int64_t p_seed) {
+	std::lock_guard<std::mutex> lock(mutex);
+	seed = (uint64_t)p_seed;
+	// xorshift can't start from zero.
+	rng_state = seed != 0 ? seed : 0x853c49e6748fea9bULL;
+}
+
+int64_t MetaPlatformSDK_Stub::get_seed() const {
+	return (int64_t)seed;
+}
+
+void MetaPlatformSDK_Stub::set_response(int32_t p_message_type, const Dictionary &p_response) {
+	Response response;
+	response.data = p_response.get("data", Variant());
+	response.error = p_response.get("error", Dictionary());
+	response.latency = p_response.get("latency", -1.0);
+	response.jitter = p_response.get("jitter", -1.0);
+
+	std::lock_guard<std::mutex> lock(mutex);
+	responses[p_message_type] = response;
+}
+
+void MetaPlatformSDK_Stub::clear_responses() {
+	std::lock_guard<std::mutex> lock(mutex);
+	responses.clear();
+}
+
+void MetaPlatformSDK_Stub::set_global(const String &p_field, const Variant &p_value) {
+	globals.set_field(p_field, p_value);
+}
+
+void MetaPlatformSDK_Stub::push_notification(int32_t p_message_type, const Variant &p_data, int32_t p_count) {
+	ERR_FAIL_COND(p_count < 0);
+	ERR_FAIL_COND_MSG(!ovrMessageType_IsNotification((ovrMessageType)p_message_type), vformat("MetaPlatformSDK_Stub: Message type %s isn't a notification.", p_message_type));
+
+	std::lock_guard<std::mutex> lock(mutex);
+	uint64_t now = _get_ticks_usec();
+	for (int32_t i = 0; i < p_count; i++) {
+		MetaPlatformSDKStubMessage *message = _make_message((ovrMessageType)p_message_type, p_data, Dictionary());
+		message->deliver_usec = now;
+		_push(message);
+	}
+	notifications_made += p_count;
+}
+
+void MetaPlatformSDK_Stub::set_notification_load(int32_t p_message_type, double p_rate, const Variant &p_data) {
+	ERR_FAIL_COND(p_rate < 0.0);
+	ERR_FAIL_COND_MSG(!ovrMessageType_IsNotification((ovrMessageType)p_message_type), vformat("MetaPlatformSDK_Stub: Message type %s isn't a notification.", p_message_type));
+
+	std::lock_guard<std::mutex> lock(mutex);
+	for (uint32_t i = 0; i < notification_loads.size(); i++) {
+		if (notification_loads[i].type == (ovrMessageType)p_message_type) {
+			notification_loads.remove_at(i);
+			break;
+		}
+	}
+	if (p_rate == 0.0) {
+		return;
+	}
+
+	if (notification_loads.is_empty()) {
+		last_load_usec = _get_ticks_usec();
+	}
+
+	NotificationLoad load;
+	load.type = (ovrMessageType)p_message_type;
+	load.rate = p_rate;
+	load.data = p_data;
+	notification_loads.push_back(load);
+}
+
+int32_t MetaPlatformSDK_Stub::get_pending_message_count() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return pending.size();
+}
+
+Dictionary MetaPlatformSDK_Stub::get_stats() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	Dictionary stats;
+	stats["requests"] = requests_made;
+	stats["notifications"] = notifications_made;
+	stats["pending"] = pending.size();
+	stats["popped"] = messages_popped;
+	stats["freed"] = messages_freed;
+	// Messages that were popped, but not freed yet. If this keeps growing, something is leaking them.
+	stats["live"] = messages_popped - messages_freed;
+	return stats;
+}
+
+void MetaPlatformSDK_Stub::reset() {
+	std::lock_guard<std::mutex> lock(mutex);
+	for (MetaPlatformSDKStubMessage *message : pending) {
+		memdelete(message);
+	}
+	pending.clear();
+	responses.clear();
+	notification_loads.clear();
+	globals.reset();
+
+	latency = 0.0;
+	jitter = 0.0;
+	rng_state = seed != 0 ? seed : 0x853c49e6748fea9bULL;
+
+	requests_made = 0;
+	notifications_made = 0;
+	messages_popped = 0;
+	messages_freed = 0;
+}
+
+MetaPlatformSDK_Stub::MetaPlatformSDK_Stub() {
+}
+
+MetaPlatformSDK_Stub::~MetaPlatformSDK_Stub() {
+	for (MetaPlatformSDKStubMessage *message : pending) {
+		memdelete(message);
+	}
+	singleton = nullptr;
+}
+#endif // META_PLATFORM_SDK_STUB
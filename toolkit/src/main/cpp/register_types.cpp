@@ -3,11 +3,44 @@
 #include "register_types.h"
 
 #include <godot_cpp/classes/engine.hpp>
+#include <godot_cpp/classes/time.hpp>
+#include <godot_cpp/variant/utility_functions.hpp>
 
 #include "editor/meta_toolkit_editor_plugin.h"
 #include "editor/meta_xr_simulator_dialog.h"
 #include "export/meta_toolkit_export_plugin.h"
+#include "meta_toolkit_performance_settings.h"
 #include "platform_sdk/meta_platform_sdk.h"
+#include "platform_sdk/meta_platform_sdk_byte_buffer.h"
+#include "platform_sdk/meta_platform_sdk_http_transfer_sink.h"
+#include "platform_sdk/meta_platform_sdk_object_pool.h"
+#include "platform_sdk/meta_platform_sdk_pager.h"
+#include "platform_sdk/meta_platform_sdk_request_group.h"
+#include "platform_sdk/meta_platform_sdk_string_cache.h"
+
+// The hand-written classes that use a Platform SDK module are only built when it's selected.
+#ifdef META_PLATFORM_SDK_MODULE_ASSET_FILE
+#include "platform_sdk/meta_platform_sdk_download_manager.h"
+#endif
+
+#ifdef META_PLATFORM_SDK_MODULE_LEADERBOARD
+#include "platform_sdk/meta_platform_sdk_leaderboard_cache.h"
+#include "platform_sdk/meta_platform_sdk_leaderboard_window.h"
+#include "platform_sdk/meta_platform_sdk_write_queue.h"
+#endif
+
+#if defined(META_PLATFORM_SDK_MODULE_ACHIEVEMENTS) && defined(META_PLATFORM_SDK_MODULE_ENTITLEMENT) && defined(META_PLATFORM_SDK_MODULE_IAP) && defined(META_PLATFORM_SDK_MODULE_USER)
+#define META_PLATFORM_SDK_WARM_START_CACHE_ENABLED
+#include "platform_sdk/meta_platform_sdk_warm_start_cache.h"
+#endif
+
+#ifdef META_TOOLKIT_BENCHMARKS_ENABLED
+#include "benchmark/meta_toolkit_benchmarks.h"
+#endif
+
+#ifdef META_PLATFORM_SDK_STUB
+#include "platform_sdk_stub/meta_platform_sdk_stub.h"
+#endif
 
 using namespace godot;
 
@@ -15,12 +48,42 @@ void initialize_toolkit_module(ModuleInitializationLevel p_level) {
 	switch (p_level) {
 		case godot::MODULE_INITIALIZATION_LEVEL_SCENE: {
 			GDREGISTER_CLASS(MetaPlatformSDK_Request);
+			GDREGISTER_CLASS(MetaPlatformSDK_RequestGroup);
+			GDREGISTER_CLASS(MetaPlatformSDK_ByteBuffer);
+			GDREGISTER_CLASS(MetaPlatformSDK_HttpTransferSink);
+			GDREGISTER_CLASS(MetaPlatformSDK_Pager);
+#ifdef META_PLATFORM_SDK_MODULE_LEADERBOARD
+			GDREGISTER_CLASS(MetaPlatformSDK_LeaderboardWindow);
+			GDREGISTER_CLASS(MetaPlatformSDK_LeaderboardCache);
+			GDREGISTER_CLASS(MetaPlatformSDK_WriteQueue);
+#endif
+#ifdef META_PLATFORM_SDK_WARM_START_CACHE_ENABLED
+			GDREGISTER_CLASS(MetaPlatformSDK_WarmStartCache);
+#endif
+#ifdef META_PLATFORM_SDK_MODULE_ASSET_FILE
+			GDREGISTER_CLASS(MetaPlatformSDK_DownloadManager);
+#endif
 
 			// Register generated classes last, because they may use the hand-written ones.
+			// The time it takes is reported with --verbose, to compare changes to the generated bindings.
+			uint64_t register_start_usec = Time::get_singleton()->get_ticks_usec();
 			MetaPlatformSDK::_register_generated_classes();
+			UtilityFunctions::print_verbose(vformat("MetaPlatformSDK: Registered generated classes in %d usec.", Time::get_singleton()->get_ticks_usec() - register_start_usec));
 
 			// Now that everything is registered, we can safely create our singleton.
 			Engine::get_singleton()->register_singleton("MetaPlatformSDK", MetaPlatformSDK::get_singleton());
+
+#ifdef META_PLATFORM_SDK_STUB
+			GDREGISTER_CLASS(MetaPlatformSDK_Stub);
+			Engine::get_singleton()->register_singleton("MetaPlatformSDK_Stub", MetaPlatformSDK_Stub::get_singleton());
+#endif
+
+#ifdef META_TOOLKIT_BENCHMARKS_ENABLED
+			GDREGISTER_CLASS(MetaToolkitBenchmarks);
+#endif
+
+			GDREGISTER_INTERNAL_CLASS(MetaToolkitPerformanceSettings);
+			MetaToolkitPerformanceSettings::initialize();
 		} break;
 		case godot::MODULE_INITIALIZATION_LEVEL_EDITOR: {
 			GDREGISTER_INTERNAL_CLASS(MetaToolkitExportPlugin);
@@ -31,7 +94,17 @@ void initialize_toolkit_module(ModuleInitializationLevel p_level) {
 	}
 }
 
-void terminate_toolkit_module(ModuleInitializationLevel p_level) {}
+void terminate_toolkit_module(ModuleInitializationLevel p_level) {
+	switch (p_level) {
+		case godot::MODULE_INITIALIZATION_LEVEL_SCENE: {
+			MetaPlatformSDK::get_singleton()->_remove_performance_monitors();
+			MetaPlatformSDK_ByteBuffer::_clear_pool();
+			MetaPlatformSDKStringCache::clear();
+			MetaPlatformSDKObjectPoolBase::clear_all();
+			MetaToolkitPerformanceSettings::finalize();
+		} break;
+	}
+}
 
 extern "C" {
 GDExtensionBool GDE_EXPORT